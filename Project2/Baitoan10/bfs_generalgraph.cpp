@@ -9,27 +9,86 @@
 using namespace std;
 
 /**
- * @brief Represents a general graph with BFS traversal capabilities
+ * @brief Per-query BFS state, so one shared graph can serve several traversals at once
  */
-class GeneralGraph {
-private:
-    vector<vector<int>> adjacencyList;
-    int numberOfVertices;
+struct BFSTraversalContext {
     vector<bool> visitedVertices;
     vector<int> traversalOrder;
     vector<int> distances;
     vector<int> parents;
     
+    /**
+     * @brief Constructs an empty context sized for a graph
+     * @param vertexCount Number of vertices in the graph
+     */
+    explicit BFSTraversalContext(int vertexCount)
+        : visitedVertices(vertexCount, false), distances(vertexCount, -1), parents(vertexCount, -1) {}
+    
     /**
      * @brief Resets visited status and other tracking arrays
      */
-    void resetTraversalStatus() {
+    void reset() {
         fill(visitedVertices.begin(), visitedVertices.end(), false);
         traversalOrder.clear();
         fill(distances.begin(), distances.end(), -1);
         fill(parents.begin(), parents.end(), -1);
     }
     
+    /**
+     * @brief Gets the shortest distance to a vertex from the BFS start of this context
+     * @param vertex Target vertex
+     * @return Distance to vertex, or -1 if unreachable
+     */
+    int getDistance(int vertex) const {
+        if (vertex < 0 || vertex >= static_cast<int>(distances.size())) {
+            return -1;
+        }
+        return distances[vertex];
+    }
+    
+    /**
+     * @brief Gets the parent of a vertex in the BFS tree of this context
+     * @param vertex Target vertex
+     * @return Parent vertex, or -1 if no parent
+     */
+    int getParent(int vertex) const {
+        if (vertex < 0 || vertex >= static_cast<int>(parents.size())) {
+            return -1;
+        }
+        return parents[vertex];
+    }
+    
+    /**
+     * @brief Gets the shortest path from the BFS start of this context to target vertex
+     * @param targetVertex Target vertex
+     * @return Vector containing path vertices, empty if no path exists
+     */
+    vector<int> getShortestPath(int targetVertex) const {
+        if (getDistance(targetVertex) == -1) {
+            return vector<int>();
+        }
+        
+        vector<int> path;
+        int current = targetVertex;
+        
+        while (current != -1) {
+            path.push_back(current);
+            current = parents[current];
+        }
+        
+        reverse(path.begin(), path.end());
+        return path;
+    }
+};
+
+/**
+ * @brief Represents a general graph with BFS traversal capabilities
+ */
+class GeneralGraph {
+private:
+    vector<vector<int>> adjacencyList;
+    int numberOfVertices;
+    
     /**
      * @brief Validates that vertices are within valid range
      * @param vertex Vertex to validate
@@ -46,9 +105,6 @@ public:
      */
     explicit GeneralGraph(int vertexCount) : numberOfVertices(vertexCount) {
         adjacencyList.resize(vertexCount);
-        visitedVertices.resize(vertexCount, false);
-        distances.resize(vertexCount, -1);
-        parents.resize(vertexCount, -1);
     }
     
     /**
@@ -78,50 +134,51 @@ public:
     /**
      * @brief Executes BFS traversal using queue-based approach
      * @param startVertex Starting vertex for traversal
+     * @param context Per-query state that receives visited flags, distances and parents
      * @return Vector containing vertices in BFS order
      */
-    vector<int> executeBFS(int startVertex) {
+    vector<int> executeBFS(int startVertex, BFSTraversalContext& context) const {
         if (!isValidVertex(startVertex)) {
             cerr << "Error: Invalid starting vertex " << startVertex << "\n";
             return vector<int>();
         }
         
-        resetTraversalStatus();
+        context.reset();
         queue<int> bfsQueue;
         
-        visitedVertices[startVertex] = true;
-        distances[startVertex] = 0;
+        context.visitedVertices[startVertex] = true;
+        context.distances[startVertex] = 0;
         bfsQueue.push(startVertex);
         
         while (!bfsQueue.empty()) {
             int currentVertex = bfsQueue.front();
             bfsQueue.pop();
-            traversalOrder.push_back(currentVertex);
+            context.traversalOrder.push_back(currentVertex);
             
             for (int neighbor : adjacencyList[currentVertex]) {
-                if (!visitedVertices[neighbor]) {
-                    visitedVertices[neighbor] = true;
-                    distances[neighbor] = distances[currentVertex] + 1;
-                    parents[neighbor] = currentVertex;
+                if (!context.visitedVertices[neighbor]) {
+                    context.visitedVertices[neighbor] = true;
+                    context.distances[neighbor] = context.distances[currentVertex] + 1;
+                    context.parents[neighbor] = currentVertex;
                     bfsQueue.push(neighbor);
                 }
             }
         }
         
-        return traversalOrder;
+        return context.traversalOrder;
     }
     
     /**
      * @brief Finds all connected components using BFS
      * @return Vector of vectors, each containing vertices of a connected component
      */
-    vector<vector<int>> findConnectedComponents() {
+    vector<vector<int>> findConnectedComponents() const {
         vector<vector<int>> components;
-        resetTraversalStatus();
+        vector<bool> visitedVertices(numberOfVertices, false);
         
         for (int vertex = 0; vertex < numberOfVertices; ++vertex) {
             if (!visitedVertices[vertex]) {
-                vector<int> component = executeBFSComponent(vertex);
+                vector<int> component = executeBFSComponent(vertex, visitedVertices);
                 if (!component.empty()) {
                     components.push_back(component);
                 }
@@ -131,52 +188,6 @@ public:
         return components;
     }
     
-    /**
-     * @brief Gets the shortest distance to a vertex from last BFS start
-     * @param vertex Target vertex
-     * @return Distance to vertex, or -1 if unreachable
-     */
-    int getDistance(int vertex) const {
-        if (!isValidVertex(vertex)) {
-            return -1;
-        }
-        return distances[vertex];
-    }
-    
-    /**
-     * @brief Gets the parent of a vertex in BFS tree from last traversal
-     * @param vertex Target vertex
-     * @return Parent vertex, or -1 if no parent
-     */
-    int getParent(int vertex) const {
-        if (!isValidVertex(vertex)) {
-            return -1;
-        }
-        return parents[vertex];
-    }
-    
-    /**
-     * @brief Gets the shortest path from last BFS start to target vertex
-     * @param targetVertex Target vertex
-     * @return Vector containing path vertices, empty if no path exists
-     */
-    vector<int> getShortestPath(int targetVertex) const {
-        if (!isValidVertex(targetVertex) || distances[targetVertex] == -1) {
-            return vector<int>();
-        }
-        
-        vector<int> path;
-        int current = targetVertex;
-        
-        while (current != -1) {
-            path.push_back(current);
-            current = parents[current];
-        }
-        
-        reverse(path.begin(), path.end());
-        return path;
-    }
-    
     /**
      * @brief Gets the number of vertices in the graph
      * @return Number of vertices
@@ -231,24 +242,25 @@ public:
     
     /**
      * @brief Displays BFS tree information
-     * @param startVertex Starting vertex of last BFS
+     * @param startVertex Starting vertex of the traversal
+     * @param context Per-query state filled by executeBFS
      */
-    void displayBFSTree(int startVertex) const {
+    void displayBFSTree(int startVertex, const BFSTraversalContext& context) const {
         cout << "\nBFS Tree Information (from vertex " << startVertex << "):\n";
         cout << "Vertex | Distance | Parent\n";
         cout << "-------|----------|-------\n";
         
         for (int vertex = 0; vertex < numberOfVertices; ++vertex) {
             cout << setw(6) << vertex << " | ";
-            if (distances[vertex] == -1) {
+            if (context.distances[vertex] == -1) {
                 cout << setw(8) << "INF" << " | ";
                 cout << "N/A";
             } else {
-                cout << setw(8) << distances[vertex] << " | ";
-                if (parents[vertex] == -1) {
+                cout << setw(8) << context.distances[vertex] << " | ";
+                if (context.parents[vertex] == -1) {
                     cout << "NIL";
                 } else {
-                    cout << parents[vertex];
+                    cout << context.parents[vertex];
                 }
             }
             cout << "\n";
@@ -259,9 +271,10 @@ private:
     /**
      * @brief Helper function for finding connected components
      * @param startVertex Starting vertex for component search
+     * @param visitedVertices Visited flags shared across the component search
      * @return Vector containing vertices in the component
      */
-    vector<int> executeBFSComponent(int startVertex) {
+    vector<int> executeBFSComponent(int startVertex, vector<bool>& visitedVertices) const {
         vector<int> component;
         queue<int> bfsQueue;
         
@@ -387,12 +400,12 @@ public:
     
     /**
      * @brief Displays shortest path information
-     * @param graph Reference to the graph
+     * @param context Per-query state of the BFS from startVertex
      * @param startVertex Starting vertex
      * @param targetVertex Target vertex
      */
-    void displayShortestPath(const GeneralGraph& graph, int startVertex, int targetVertex) {
-        vector<int> path = graph.getShortestPath(targetVertex);
+    void displayShortestPath(const BFSTraversalContext& context, int startVertex, int targetVertex) {
+        vector<int> path = context.getShortestPath(targetVertex);
         
         if (path.empty()) {
             outputStream << "No path exists from vertex " << startVertex 
@@ -404,7 +417,20 @@ public:
                 if (i > 0) outputStream << " -> ";
                 outputStream << path[i];
             }
-            outputStream << " (distance: " << graph.getDistance(targetVertex) << ")\n";
+            outputStream << " (distance: " << context.getDistance(targetVertex) << ")\n";
+        }
+    }
+    
+    /**
+     * @brief Displays results of the concurrent all-sources BFS pass
+     * @param reachableCounts Number of vertices reached from each source
+     * @param eccentricities Largest BFS distance from each source
+     */
+    void displayConcurrentQueryResults(const vector<int>& reachableCounts, const vector<int>& eccentricities) {
+        outputStream << "\nConcurrent BFS from every vertex over one shared graph:\n";
+        for (size_t vertex = 0; vertex < reachableCounts.size(); ++vertex) {
+            outputStream << "Vertex " << vertex << ": reaches " << reachableCounts[vertex]
+                         << " vertices, eccentricity " << eccentricities[vertex] << "\n";
         }
     }
     
@@ -422,7 +448,7 @@ public:
  */
 class GeneralGraphBFSApplication {
 private:
-    unique_ptr<GeneralGraph> graphInstance;
+    shared_ptr<const GeneralGraph> graphSnapshot;
     unique_ptr<GeneralGraphInputHandler> inputHandler;
     unique_ptr<GeneralGraphOutputHandler> outputHandler;
     
@@ -442,7 +468,7 @@ public:
      */
     void executeApplication() {
         outputHandler->displayProgramHeader();
-        graphInstance = inputHandler->readGraphData();
+        graphSnapshot = inputHandler->readGraphData();
         int startingVertex = inputHandler->readStartingVertex();
         performBFSAnalysis(startingVertex);
     }
@@ -454,26 +480,60 @@ private:
      */
     void performBFSAnalysis(int startVertex) {
         // Display graph structure
-        graphInstance->displayGraph();
+        graphSnapshot->displayGraph();
         
         // Perform BFS traversal
-        vector<int> bfsResult = graphInstance->executeBFS(startVertex);
+        BFSTraversalContext traversalContext(graphSnapshot->getVertexCount());
+        vector<int> bfsResult = graphSnapshot->executeBFS(startVertex, traversalContext);
         outputHandler->displayTraversalResult(bfsResult, startVertex);
         
         // Display BFS tree information
-        graphInstance->displayBFSTree(startVertex);
+        graphSnapshot->displayBFSTree(startVertex, traversalContext);
         
         // Find and display connected components
-        vector<vector<int>> components = graphInstance->findConnectedComponents();
+        vector<vector<int>> components = graphSnapshot->findConnectedComponents();
         outputHandler->displayConnectedComponents(components);
         
         // Display shortest path examples to all reachable vertices
         cout << "\nShortest Paths from vertex " << startVertex << ":\n";
-        for (int target = 0; target < graphInstance->getVertexCount(); ++target) {
-            if (target != startVertex && graphInstance->getDistance(target) != -1) {
-                outputHandler->displayShortestPath(*graphInstance, startVertex, target);
+        for (int target = 0; target < graphSnapshot->getVertexCount(); ++target) {
+            if (target != startVertex && traversalContext.getDistance(target) != -1) {
+                outputHandler->displayShortestPath(traversalContext, startVertex, target);
+            }
+        }
+        
+        performConcurrentBFSQueries();
+    }
+    
+    /**
+     * @brief Runs a BFS from every vertex on worker threads that share the read-only graph
+     * @details Each worker owns one BFSTraversalContext and reuses it for all of its sources
+     */
+    void performConcurrentBFSQueries() {
+        int vertexCount = graphSnapshot->getVertexCount();
+        vector<int> reachableCounts(vertexCount, 0);
+        vector<int> eccentricities(vertexCount, 0);
+        atomic<int> nextSource(0);
+        
+        auto runWorker = [&]() {
+            BFSTraversalContext workerContext(vertexCount);
+            for (int source = nextSource++; source < vertexCount; source = nextSource++) {
+                vector<int> order = graphSnapshot->executeBFS(source, workerContext);
+                reachableCounts[source] = static_cast<int>(order.size());
+                eccentricities[source] = workerContext.getDistance(order.back());
             }
+        };
+        
+        int workerCount = max(1, min(vertexCount, static_cast<int>(thread::hardware_concurrency())));
+        vector<thread> workers;
+        for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+            workers.emplace_back(runWorker);
+        }
+        for (thread& worker : workers) {
+            worker.join();
         }
+        
+        outputHandler->displayConcurrentQueryResults(reachableCounts, eccentricities);
     }
 };
 
@@ -8,6 +8,28 @@
 
 using namespace std;
 
+/**
+ * @brief Per-query DFS state, so one shared graph can serve several traversals at once
+ */
+struct DFSTraversalContext {
+    vector<bool> visitedVertices;
+    vector<int> traversalOrder;
+    
+    /**
+     * @brief Constructs an empty context sized for a graph
+     * @param vertexCount Number of vertices in the graph
+     */
+    explicit DFSTraversalContext(int vertexCount) : visitedVertices(vertexCount, false) {}
+    
+    /**
+     * @brief Resets visited status for all vertices
+     */
+    void reset() {
+        fill(visitedVertices.begin(), visitedVertices.end(), false);
+        traversalOrder.clear();
+    }
+};
+
 /**
  * @brief Represents a multi graph with DFS traversal capabilities
  */
@@ -15,31 +37,22 @@ class MultiGraph {
 private:
     vector<vector<int>> adjacencyList;
     int numberOfVertices;
-    vector<bool> visitedVertices;
-    vector<int> traversalOrder;
     
     /**
      * @brief Performs recursive DFS from given vertex
      * @param currentVertex Starting vertex for DFS
+     * @param context Per-query state that receives visited flags and traversal order
      */
-    void performRecursiveDFS(int currentVertex) {
-        visitedVertices[currentVertex] = true;
-        traversalOrder.push_back(currentVertex);
+    void performRecursiveDFS(int currentVertex, DFSTraversalContext& context) const {
+        context.visitedVertices[currentVertex] = true;
+        context.traversalOrder.push_back(currentVertex);
         for (int neighbor : adjacencyList[currentVertex]) {
-            if (!visitedVertices[neighbor]) {
-                performRecursiveDFS(neighbor);
+            if (!context.visitedVertices[neighbor]) {
+                performRecursiveDFS(neighbor, context);
             }
         }
     }
     
-    /**
-     * @brief Resets visited status for all vertices
-     */
-    void resetVisitedStatus() {
-        fill(visitedVertices.begin(), visitedVertices.end(), false);
-        traversalOrder.clear();
-    }
-    
     /**
      * @brief Validates that vertices are within valid range
      * @param vertex Vertex to validate
@@ -56,7 +69,6 @@ public:
      */
     explicit MultiGraph(int vertexCount) : numberOfVertices(vertexCount) {
         adjacencyList.resize(vertexCount);
-        visitedVertices.resize(vertexCount, false);
     }
     
     /**
@@ -87,48 +99,50 @@ public:
     /**
      * @brief Executes DFS traversal using recursive approach
      * @param startVertex Starting vertex for traversal
+     * @param context Per-query state that receives visited flags and traversal order
      * @return Vector containing vertices in DFS order
      */
-    vector<int> executeRecursiveDFS(int startVertex) {
+    vector<int> executeRecursiveDFS(int startVertex, DFSTraversalContext& context) const {
         if (!isValidVertex(startVertex)) {
             cerr << "Error: Invalid starting vertex " << startVertex << "\n";
             return vector<int>();
         }
-        resetVisitedStatus();
-        performRecursiveDFS(startVertex);
-        return traversalOrder;
+        context.reset();
+        performRecursiveDFS(startVertex, context);
+        return context.traversalOrder;
     }
     
     /**
      * @brief Executes DFS traversal using iterative approach with stack
      * @param startVertex Starting vertex for traversal
+     * @param context Per-query state that receives visited flags and traversal order
      * @return Vector containing vertices in DFS order
      */
-    vector<int> executeIterativeDFS(int startVertex) {
+    vector<int> executeIterativeDFS(int startVertex, DFSTraversalContext& context) const {
         if (!isValidVertex(startVertex)) {
             cerr << "Error: Invalid starting vertex " << startVertex << "\n";
             return vector<int>();
         }
         
-        resetVisitedStatus();
+        context.reset();
         stack<int> dfsStack;
         dfsStack.push(startVertex);
         
         while (!dfsStack.empty()) {
             int currentVertex = dfsStack.top();
             dfsStack.pop();
-            if (!visitedVertices[currentVertex]) {
-                visitedVertices[currentVertex] = true;
-                traversalOrder.push_back(currentVertex);
+            if (!context.visitedVertices[currentVertex]) {
+                context.visitedVertices[currentVertex] = true;
+                context.traversalOrder.push_back(currentVertex);
                 for (int i = static_cast<int>(adjacencyList[currentVertex].size()) - 1; i >= 0; --i) {
                     int neighbor = adjacencyList[currentVertex][i];
-                    if (!visitedVertices[neighbor]) {
+                    if (!context.visitedVertices[neighbor]) {
                         dfsStack.push(neighbor);
                     }
                 }
             }
         }
-        return traversalOrder;
+        return context.traversalOrder;
     }
     
     /**
@@ -289,6 +303,17 @@ public:
         outputStream << "\n";
     }
     
+    /**
+     * @brief Displays results of the concurrent all-sources DFS pass
+     * @param reachableCounts Number of vertices reached from each source
+     */
+    void displayConcurrentQueryResults(const vector<int>& reachableCounts) {
+        outputStream << "\nConcurrent DFS from every vertex over one shared graph:\n";
+        for (size_t vertex = 0; vertex < reachableCounts.size(); ++vertex) {
+            outputStream << "Vertex " << vertex << ": reaches " << reachableCounts[vertex] << " vertices\n";
+        }
+    }
+    
     /**
      * @brief Displays program header information
      */
@@ -303,7 +328,7 @@ public:
  */
 class MultiGraphDFSApplication {
 private:
-    unique_ptr<MultiGraph> graphInstance;
+    shared_ptr<const MultiGraph> graphSnapshot;
     unique_ptr<MultiGraphInputHandler> inputHandler;
     unique_ptr<MultiGraphOutputHandler> outputHandler;
     
@@ -323,7 +348,7 @@ public:
      */
     void executeApplication() {
         outputHandler->displayProgramHeader();
-        graphInstance = inputHandler->readGraphData();
+        graphSnapshot = inputHandler->readGraphData();
         int startingVertex = inputHandler->readStartingVertex();
         performDFSAnalysis(startingVertex);
     }
@@ -334,14 +359,45 @@ private:
      * @param startVertex Starting vertex for analysis
      */
     void performDFSAnalysis(int startVertex) {
-        graphInstance->displayGraph();
-        graphInstance->displayParallelEdgeStatistics();
+        graphSnapshot->displayGraph();
+        graphSnapshot->displayParallelEdgeStatistics();
         
-        vector<int> recursiveResult = graphInstance->executeRecursiveDFS(startVertex);
+        DFSTraversalContext traversalContext(graphSnapshot->getVertexCount());
+        vector<int> recursiveResult = graphSnapshot->executeRecursiveDFS(startVertex, traversalContext);
         outputHandler->displayTraversalResult(recursiveResult, "using recursion");
         
-        vector<int> iterativeResult = graphInstance->executeIterativeDFS(startVertex);
+        vector<int> iterativeResult = graphSnapshot->executeIterativeDFS(startVertex, traversalContext);
         outputHandler->displayTraversalResult(iterativeResult, "using iteration");
+        
+        performConcurrentDFSQueries();
+    }
+    
+    /**
+     * @brief Runs a DFS from every vertex on worker threads that share the read-only graph
+     * @details Each worker owns one DFSTraversalContext and reuses it for all of its sources
+     */
+    void performConcurrentDFSQueries() {
+        int vertexCount = graphSnapshot->getVertexCount();
+        vector<int> reachableCounts(vertexCount, 0);
+        atomic<int> nextSource(0);
+        
+        auto runWorker = [&]() {
+            DFSTraversalContext workerContext(vertexCount);
+            for (int source = nextSource++; source < vertexCount; source = nextSource++) {
+                reachableCounts[source] = static_cast<int>(graphSnapshot->executeIterativeDFS(source, workerContext).size());
+            }
+        };
+        
+        int workerCount = max(1, min(vertexCount, static_cast<int>(thread::hardware_concurrency())));
+        vector<thread> workers;
+        for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+            workers.emplace_back(runWorker);
+        }
+        for (thread& worker : workers) {
+            worker.join();
+        }
+        
+        outputHandler->displayConcurrentQueryResults(reachableCounts);
     }
 };
 
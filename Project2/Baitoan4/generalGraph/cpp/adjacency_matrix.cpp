@@ -68,13 +68,59 @@ AdjacencyMatrix readAdjacencyMatrixFromEdgeList(const std::string& fileName) {
     return adjacencyMatrix;
 }
 
+/**
+ * @brief Display adjacency matrix as edge count, degree histogram, top-degree vertices and sample rows
+ * @details Sampled rows list only the non-zero columns, with multiplicities above one as column(xcount)
+ * @param adjacencyMatrix The adjacency matrix to summarize
+ */
+void displayAdjacencyMatrixSummary(const AdjacencyMatrix& adjacencyMatrix) {
+    std::vector<int> outDegrees(adjacencyMatrix.numberOfVertices, 0);
+    long long numberOfEdges = 0;
+    for (int rowIndex = 0; rowIndex < adjacencyMatrix.numberOfVertices; ++rowIndex) {
+        for (int cellValue : adjacencyMatrix.matrixData[rowIndex]) {
+            outDegrees[rowIndex] += cellValue;
+        }
+        numberOfEdges += outDegrees[rowIndex];
+    }
+    std::cout << "Number of edges: " << numberOfEdges << std::endl;
+    displayDegreeSummary(outDegrees, "Out-degree");
+
+    displaySampleRows(adjacencyMatrix.numberOfVertices, [&](int rowIndex) {
+        std::vector<int> nonZeroColumns;
+        for (int columnIndex = 0; columnIndex < adjacencyMatrix.numberOfVertices; ++columnIndex) {
+            if (adjacencyMatrix.matrixData[rowIndex][columnIndex] != 0) {
+                nonZeroColumns.push_back(columnIndex);
+            }
+        }
+        std::cout << "Row " << rowIndex << ": ";
+        if (nonZeroColumns.empty()) {
+            std::cout << "(all zero)";
+        } else {
+            displayTruncatedRowEntries(static_cast<int>(nonZeroColumns.size()), " ", [&](int entryIndex) {
+                int columnIndex = nonZeroColumns[entryIndex];
+                std::cout << columnIndex;
+                if (adjacencyMatrix.matrixData[rowIndex][columnIndex] > 1) {
+                    std::cout << "(x" << adjacencyMatrix.matrixData[rowIndex][columnIndex] << ")";
+                }
+            });
+        }
+        std::cout << std::endl;
+    });
+    std::cout << std::endl;
+}
+
 /**
  * @brief Display adjacency matrix to console
  * @param adjacencyMatrix The adjacency matrix to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
  */
-void displayAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix) {
+void displayAdjacencyMatrix(const AdjacencyMatrix& adjacencyMatrix, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
     std::cout << "=== Adjacency Matrix ===" << std::endl;
     std::cout << "Number of vertices: " << adjacencyMatrix.numberOfVertices << std::endl;
+    if (!shouldDisplayFullGraph(adjacencyMatrix.numberOfVertices, displayMode)) {
+        displayAdjacencyMatrixSummary(adjacencyMatrix);
+        return;
+    }
     
     for (int rowIndex = 0; rowIndex < adjacencyMatrix.numberOfVertices; ++rowIndex) {
         for (int columnIndex = 0; columnIndex < adjacencyMatrix.numberOfVertices; ++columnIndex) {
@@ -0,0 +1,462 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <cstdint>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Cell value meaning "the real count is in the spill table"
+ * @details Counts 1..254 are stored inline; a count of 255 or more lives in spilledCells
+ */
+const int COMPACT_CELL_SPILL_MARKER = 255;
+
+/**
+ * @brief Adjacency matrix for general graph with one byte per cell and a sparse table for large multiplicities
+ */
+struct CompactMultiplicityMatrix {
+    std::vector<std::uint8_t> cellData;
+    std::map<long long, int> spilledCells;
+    int numberOfVertices;
+    long long numberOfEdges;
+
+    /**
+     * @brief Default constructor
+     */
+    CompactMultiplicityMatrix() : numberOfVertices(0), numberOfEdges(0) {}
+
+    /**
+     * @brief Constructor with vertex count
+     * @param vertexCount Number of vertices in the graph
+     */
+    CompactMultiplicityMatrix(int vertexCount) : numberOfVertices(vertexCount), numberOfEdges(0) {
+        cellData.assign(static_cast<std::size_t>(vertexCount) * vertexCount, 0);
+    }
+
+    /**
+     * @brief Approximate heap footprint of the cells and the spill table
+     * @return Size in bytes
+     */
+    std::size_t memoryBytes() const {
+        // A std::map node holds the key/value pair plus three pointers and a colour word
+        return cellData.capacity() + spilledCells.size() * (sizeof(std::pair<const long long, int>) + 4 * sizeof(void*));
+    }
+};
+
+/**
+ * @brief Linear position of a cell in cellData and key of the cell in spilledCells
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Row of the cell
+ * @param columnIndex Column of the cell
+ * @return Row-major cell position
+ */
+long long getCompactCellPosition(const CompactMultiplicityMatrix& compactMatrix, int rowIndex, int columnIndex) {
+    return static_cast<long long>(rowIndex) * compactMatrix.numberOfVertices + columnIndex;
+}
+
+/**
+ * @brief Read the multiplicity of one cell
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @param columnIndex Target vertex
+ * @return Number of parallel edges from rowIndex to columnIndex
+ */
+int getCompactMultiplicity(const CompactMultiplicityMatrix& compactMatrix, int rowIndex, int columnIndex) {
+    long long cellPosition = getCompactCellPosition(compactMatrix, rowIndex, columnIndex);
+    int cellValue = compactMatrix.cellData[cellPosition];
+    if (cellValue == COMPACT_CELL_SPILL_MARKER) {
+        return compactMatrix.spilledCells.at(cellPosition);
+    }
+    return cellValue;
+}
+
+/**
+ * @brief Add one edge instance to a cell, moving the cell to the spill table when it outgrows a byte
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @param columnIndex Target vertex
+ */
+void incrementCompactMultiplicity(CompactMultiplicityMatrix& compactMatrix, int rowIndex, int columnIndex) {
+    long long cellPosition = getCompactCellPosition(compactMatrix, rowIndex, columnIndex);
+    std::uint8_t& cellValue = compactMatrix.cellData[cellPosition];
+    if (cellValue < COMPACT_CELL_SPILL_MARKER - 1) {
+        cellValue++;
+    } else if (cellValue == COMPACT_CELL_SPILL_MARKER - 1) {
+        cellValue = COMPACT_CELL_SPILL_MARKER;
+        compactMatrix.spilledCells[cellPosition] = COMPACT_CELL_SPILL_MARKER;
+    } else {
+        compactMatrix.spilledCells[cellPosition]++;
+    }
+    compactMatrix.numberOfEdges++;
+}
+
+/**
+ * @brief Add `multiplicity` edge instances to a cell
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @param columnIndex Target vertex
+ * @param multiplicity Number of parallel edges to add
+ */
+void addCompactMultiplicity(CompactMultiplicityMatrix& compactMatrix, int rowIndex, int columnIndex, int multiplicity) {
+    if (multiplicity <= 0) {
+        return;
+    }
+    long long cellPosition = getCompactCellPosition(compactMatrix, rowIndex, columnIndex);
+    int newCount = getCompactMultiplicity(compactMatrix, rowIndex, columnIndex) + multiplicity;
+    if (newCount >= COMPACT_CELL_SPILL_MARKER) {
+        compactMatrix.cellData[cellPosition] = COMPACT_CELL_SPILL_MARKER;
+        compactMatrix.spilledCells[cellPosition] = newCount;
+    } else {
+        compactMatrix.cellData[cellPosition] = static_cast<std::uint8_t>(newCount);
+    }
+    compactMatrix.numberOfEdges += multiplicity;
+}
+
+/**
+ * @brief Count the distinct out-neighbors of a row, comparing 16 cells per step with SSE2
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @return Number of non-zero cells in the row
+ */
+int countCompactRowNonZeroCells(const CompactMultiplicityMatrix& compactMatrix, int rowIndex) {
+    const std::uint8_t* rowData = compactMatrix.cellData.data() + getCompactCellPosition(compactMatrix, rowIndex, 0);
+    int rowLength = compactMatrix.numberOfVertices;
+    int columnIndex = 0;
+    int nonZeroCount = 0;
+#if defined(__SSE2__)
+    const __m128i zeroBlock = _mm_setzero_si128();
+    for (; columnIndex + 16 <= rowLength; columnIndex += 16) {
+        __m128i cellBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowData + columnIndex));
+        int zeroMask = _mm_movemask_epi8(_mm_cmpeq_epi8(cellBlock, zeroBlock));
+        nonZeroCount += 16 - __builtin_popcount(zeroMask);
+    }
+#endif
+    for (; columnIndex < rowLength; ++columnIndex) {
+        nonZeroCount += rowData[columnIndex] != 0;
+    }
+    return nonZeroCount;
+}
+
+/**
+ * @brief Sum the multiplicities of a row (its out-degree), adding 16 cells per step with SSE2 SAD
+ * @details Spilled cells are summed as the marker first, then corrected from the spill table
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @return Total number of edge instances leaving rowIndex
+ */
+long long sumCompactRowMultiplicities(const CompactMultiplicityMatrix& compactMatrix, int rowIndex) {
+    long long rowBegin = getCompactCellPosition(compactMatrix, rowIndex, 0);
+    const std::uint8_t* rowData = compactMatrix.cellData.data() + rowBegin;
+    int rowLength = compactMatrix.numberOfVertices;
+    int columnIndex = 0;
+    long long rowSum = 0;
+#if defined(__SSE2__)
+    const __m128i zeroBlock = _mm_setzero_si128();
+    __m128i partialSums = _mm_setzero_si128();
+    for (; columnIndex + 16 <= rowLength; columnIndex += 16) {
+        __m128i cellBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowData + columnIndex));
+        partialSums = _mm_add_epi64(partialSums, _mm_sad_epu8(cellBlock, zeroBlock));
+    }
+    long long laneSums[2];
+    _mm_storeu_si128(reinterpret_cast<__m128i*>(laneSums), partialSums);
+    rowSum = laneSums[0] + laneSums[1];
+#endif
+    for (; columnIndex < rowLength; ++columnIndex) {
+        rowSum += rowData[columnIndex];
+    }
+
+    for (auto spillIterator = compactMatrix.spilledCells.lower_bound(rowBegin);
+         spillIterator != compactMatrix.spilledCells.end() && spillIterator->first < rowBegin + rowLength; ++spillIterator) {
+        rowSum += spillIterator->second - COMPACT_CELL_SPILL_MARKER;
+    }
+    return rowSum;
+}
+
+/**
+ * @brief Visit the non-zero cells of a row in column order, skipping all-zero 16-cell blocks with SSE2
+ * @param compactMatrix The compact matrix
+ * @param rowIndex Source vertex
+ * @param visitCell Called as visitCell(column, multiplicity) for each non-zero cell
+ */
+template <typename CellVisitor>
+void forEachCompactRowCell(const CompactMultiplicityMatrix& compactMatrix, int rowIndex, CellVisitor visitCell) {
+    const std::uint8_t* rowData = compactMatrix.cellData.data() + getCompactCellPosition(compactMatrix, rowIndex, 0);
+    int rowLength = compactMatrix.numberOfVertices;
+    int columnIndex = 0;
+#if defined(__SSE2__)
+    const __m128i zeroBlock = _mm_setzero_si128();
+    for (; columnIndex + 16 <= rowLength; columnIndex += 16) {
+        __m128i cellBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rowData + columnIndex));
+        int nonZeroMask = ~_mm_movemask_epi8(_mm_cmpeq_epi8(cellBlock, zeroBlock)) & 0xFFFF;
+        while (nonZeroMask != 0) {
+            int cellColumn = columnIndex + __builtin_ctz(nonZeroMask);
+            visitCell(cellColumn, getCompactMultiplicity(compactMatrix, rowIndex, cellColumn));
+            nonZeroMask &= nonZeroMask - 1;
+        }
+    }
+#endif
+    for (; columnIndex < rowLength; ++columnIndex) {
+        if (rowData[columnIndex] != 0) {
+            visitCell(columnIndex, getCompactMultiplicity(compactMatrix, rowIndex, columnIndex));
+        }
+    }
+}
+
+/**
+ * @brief Read compact multiplicity matrix from edge list file, without a full int matrix
+ * @param fileName Name of input file containing edge list
+ * @return CompactMultiplicityMatrix structure containing the graph data
+ */
+CompactMultiplicityMatrix readCompactMultiplicityMatrixFromEdgeList(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        exit(1);
+    }
+
+    int numberOfVertices, numberOfEdges;
+    inputFile >> numberOfVertices >> numberOfEdges;
+
+    CompactMultiplicityMatrix compactMatrix(numberOfVertices);
+
+    for (int edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        inputFile >> sourceVertex >> targetVertex;
+
+        if (sourceVertex >= 0 && sourceVertex < numberOfVertices &&
+            targetVertex >= 0 && targetVertex < numberOfVertices) {
+            incrementCompactMultiplicity(compactMatrix, sourceVertex, targetVertex);
+        }
+    }
+
+    inputFile.close();
+    return compactMatrix;
+}
+
+/**
+ * @brief Convert int adjacency matrix to compact multiplicity matrix
+ * @param matrixData The adjacency matrix data
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompactMultiplicityMatrix structure containing the converted data
+ */
+CompactMultiplicityMatrix convertMatrixToCompactMatrix(const std::vector<std::vector<int>>& matrixData, int numberOfVertices) {
+    CompactMultiplicityMatrix compactMatrix(numberOfVertices);
+
+    for (int rowIndex = 0; rowIndex < numberOfVertices; ++rowIndex) {
+        for (int columnIndex = 0; columnIndex < numberOfVertices; ++columnIndex) {
+            addCompactMultiplicity(compactMatrix, rowIndex, columnIndex, matrixData[rowIndex][columnIndex]);
+        }
+    }
+
+    return compactMatrix;
+}
+
+/**
+ * @brief Convert adjacency list to compact multiplicity matrix
+ * @param adjacencyData The adjacency list data
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompactMultiplicityMatrix structure containing the converted data
+ */
+CompactMultiplicityMatrix convertAdjacencyListToCompactMatrix(const std::vector<std::vector<int>>& adjacencyData, int numberOfVertices) {
+    CompactMultiplicityMatrix compactMatrix(numberOfVertices);
+
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyData[sourceVertex]) {
+            if (targetVertex >= 0 && targetVertex < numberOfVertices) {
+                incrementCompactMultiplicity(compactMatrix, sourceVertex, targetVertex);
+            }
+        }
+    }
+
+    return compactMatrix;
+}
+
+/**
+ * @brief Convert extended adjacency list to compact multiplicity matrix
+ * @param edgeInstances List of all edge instances as (source, target) pairs
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompactMultiplicityMatrix structure containing the converted data
+ */
+CompactMultiplicityMatrix convertExtendedAdjacencyListToCompactMatrix(const std::vector<std::pair<int, int>>& edgeInstances, int numberOfVertices) {
+    CompactMultiplicityMatrix compactMatrix(numberOfVertices);
+
+    for (const auto& edge : edgeInstances) {
+        if (edge.first >= 0 && edge.first < numberOfVertices &&
+            edge.second >= 0 && edge.second < numberOfVertices) {
+            incrementCompactMultiplicity(compactMatrix, edge.first, edge.second);
+        }
+    }
+
+    return compactMatrix;
+}
+
+/**
+ * @brief Convert adjacency map to compact multiplicity matrix
+ * @param outgoingConnections Map of outgoing connections for each vertex
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompactMultiplicityMatrix structure containing the converted data
+ */
+CompactMultiplicityMatrix convertAdjacencyMapToCompactMatrix(const std::map<int, std::vector<std::pair<int, std::pair<int, int>>>>& outgoingConnections, int numberOfVertices) {
+    CompactMultiplicityMatrix compactMatrix(numberOfVertices);
+
+    for (const auto& vertexPair : outgoingConnections) {
+        int sourceVertex = vertexPair.first;
+        if (sourceVertex < 0 || sourceVertex >= numberOfVertices) {
+            continue;
+        }
+        for (const auto& connection : vertexPair.second) {
+            if (connection.first >= 0 && connection.first < numberOfVertices) {
+                incrementCompactMultiplicity(compactMatrix, sourceVertex, connection.first);
+            }
+        }
+    }
+
+    return compactMatrix;
+}
+
+/**
+ * @brief Convert compact multiplicity matrix back to an int adjacency matrix
+ * @param compactMatrix The compact matrix
+ * @return AdjacencyMatrix structure containing the converted data
+ */
+AdjacencyMatrix convertCompactMatrixToMatrix(const CompactMultiplicityMatrix& compactMatrix) {
+    AdjacencyMatrix adjacencyMatrix;
+    adjacencyMatrix.numberOfVertices = compactMatrix.numberOfVertices;
+    adjacencyMatrix.matrixData.assign(compactMatrix.numberOfVertices, std::vector<int>(compactMatrix.numberOfVertices, 0));
+
+    for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+        forEachCompactRowCell(compactMatrix, rowIndex, [&](int columnIndex, int multiplicity) {
+            adjacencyMatrix.matrixData[rowIndex][columnIndex] = multiplicity;
+        });
+    }
+
+    return adjacencyMatrix;
+}
+
+/**
+ * @brief Convert compact multiplicity matrix to adjacency list, repeating a target once per parallel edge
+ * @details Rows are emitted in column order, the same order as convertMatrixToAdjacencyList
+ * @param compactMatrix The compact matrix
+ * @return AdjacencyList structure containing the converted data
+ */
+AdjacencyList convertCompactMatrixToAdjacencyList(const CompactMultiplicityMatrix& compactMatrix) {
+    AdjacencyList adjacencyList;
+    adjacencyList.numberOfVertices = compactMatrix.numberOfVertices;
+    adjacencyList.adjacencyData.resize(compactMatrix.numberOfVertices);
+
+    for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+        std::vector<int>& neighbors = adjacencyList.adjacencyData[rowIndex];
+        neighbors.reserve(sumCompactRowMultiplicities(compactMatrix, rowIndex));
+        forEachCompactRowCell(compactMatrix, rowIndex, [&](int columnIndex, int multiplicity) {
+            neighbors.insert(neighbors.end(), multiplicity, columnIndex);
+        });
+    }
+
+    return adjacencyList;
+}
+
+/**
+ * @brief Convert compact multiplicity matrix to extended adjacency list
+ * @param compactMatrix The compact matrix
+ * @return ExtendedAdjacencyList structure containing the converted data
+ */
+ExtendedAdjacencyList convertCompactMatrixToExtendedAdjacencyList(const CompactMultiplicityMatrix& compactMatrix) {
+    AdjacencyList adjacencyList = convertCompactMatrixToAdjacencyList(compactMatrix);
+    return convertAdjacencyListToExtended(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+}
+
+/**
+ * @brief Convert compact multiplicity matrix to adjacency map
+ * @param compactMatrix The compact matrix
+ * @return AdjacencyMap structure containing the converted data
+ */
+AdjacencyMap convertCompactMatrixToAdjacencyMap(const CompactMultiplicityMatrix& compactMatrix) {
+    AdjacencyList adjacencyList = convertCompactMatrixToAdjacencyList(compactMatrix);
+    return convertAdjacencyListToMap(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+}
+
+/**
+ * @brief Convert compact multiplicity matrix to CSR, sizing every row with the SIMD row sum first
+ * @param compactMatrix The compact matrix
+ * @return CompressedSparseRow structure containing the converted data
+ */
+CompressedSparseRow convertCompactMatrixToCompressedSparseRow(const CompactMultiplicityMatrix& compactMatrix) {
+    CompressedSparseRow csrGraph;
+    csrGraph.numberOfVertices = compactMatrix.numberOfVertices;
+    csrGraph.rowOffsets.assign(compactMatrix.numberOfVertices + 1, 0);
+    for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+        csrGraph.rowOffsets[rowIndex + 1] = csrGraph.rowOffsets[rowIndex] +
+                                            static_cast<int>(sumCompactRowMultiplicities(compactMatrix, rowIndex));
+    }
+
+    csrGraph.numberOfEdges = csrGraph.rowOffsets[compactMatrix.numberOfVertices];
+    csrGraph.columnIndices.resize(csrGraph.numberOfEdges);
+    for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+        int writePosition = csrGraph.rowOffsets[rowIndex];
+        forEachCompactRowCell(compactMatrix, rowIndex, [&](int columnIndex, int multiplicity) {
+            std::fill(csrGraph.columnIndices.begin() + writePosition,
+                      csrGraph.columnIndices.begin() + writePosition + multiplicity, columnIndex);
+            writePosition += multiplicity;
+        });
+    }
+
+    return csrGraph;
+}
+
+/**
+ * @brief Display compact multiplicity matrix to console in the same layout as the int matrix
+ * @param compactMatrix The compact matrix to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
+ */
+void displayCompactMultiplicityMatrix(const CompactMultiplicityMatrix& compactMatrix, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
+    std::cout << "=== Compact Multiplicity Matrix ===" << std::endl;
+    std::cout << "Number of vertices: " << compactMatrix.numberOfVertices << std::endl;
+    std::cout << "Number of edges: " << compactMatrix.numberOfEdges << std::endl;
+    std::cout << "Spilled cells (count >= " << COMPACT_CELL_SPILL_MARKER << "): " << compactMatrix.spilledCells.size() << std::endl;
+    std::cout << "Memory: " << compactMatrix.memoryBytes() << " bytes (int matrix: "
+              << static_cast<long long>(compactMatrix.numberOfVertices) * compactMatrix.numberOfVertices * sizeof(int)
+              << " bytes)" << std::endl;
+
+    if (!shouldDisplayFullGraph(compactMatrix.numberOfVertices, displayMode)) {
+        std::vector<int> outDegrees(compactMatrix.numberOfVertices);
+        for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+            outDegrees[rowIndex] = static_cast<int>(sumCompactRowMultiplicities(compactMatrix, rowIndex));
+        }
+        displayDegreeSummary(outDegrees, "Out-degree");
+        displaySampleRows(compactMatrix.numberOfVertices, [&](int rowIndex) {
+            std::vector<std::pair<int, int>> rowCells;
+            forEachCompactRowCell(compactMatrix, rowIndex, [&](int columnIndex, int multiplicity) {
+                rowCells.push_back({columnIndex, multiplicity});
+            });
+            std::cout << "Row " << rowIndex << ": ";
+            if (rowCells.empty()) {
+                std::cout << "(all zero)";
+            } else {
+                displayTruncatedRowEntries(static_cast<int>(rowCells.size()), " ", [&](int entryIndex) {
+                    std::cout << rowCells[entryIndex].first;
+                    if (rowCells[entryIndex].second > 1) {
+                        std::cout << "(x" << rowCells[entryIndex].second << ")";
+                    }
+                });
+            }
+            std::cout << std::endl;
+        });
+        std::cout << std::endl;
+        return;
+    }
+
+    for (int rowIndex = 0; rowIndex < compactMatrix.numberOfVertices; ++rowIndex) {
+        for (int columnIndex = 0; columnIndex < compactMatrix.numberOfVertices; ++columnIndex) {
+            std::cout << getCompactMultiplicity(compactMatrix, rowIndex, columnIndex);
+            if (columnIndex < compactMatrix.numberOfVertices - 1) {
+                std::cout << " ";
+            }
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,480 @@
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdint>
+#include <cstring>
+
+#ifndef _WIN32
+#include <cerrno>
+#include <fcntl.h>
+#include <poll.h>
+#include <signal.h>
+#include <sys/socket.h>
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Outcome of a breadth-first search run across shard worker processes
+ */
+struct DistributedTraversalResult {
+    std::vector<int> vertexDistances;
+    int levelCount;
+    long long exchangedVertexCount;
+
+    /**
+     * @brief Default constructor
+     */
+    DistributedTraversalResult() : levelCount(0), exchangedVertexCount(0) {}
+};
+
+/**
+ * @brief Single-process breadth-first search, used as the reference for the distributed run
+ * @param adjacencyList The graph
+ * @param sourceVertex Start vertex
+ * @return Hop distance of every vertex, -1 if unreachable
+ */
+std::vector<int> computeBreadthFirstDistances(const AdjacencyList& adjacencyList, int sourceVertex) {
+    std::vector<int> vertexDistances(adjacencyList.numberOfVertices, -1);
+    if (sourceVertex < 0 || sourceVertex >= adjacencyList.numberOfVertices) {
+        return vertexDistances;
+    }
+    std::vector<int> vertexQueue(1, sourceVertex);
+    vertexDistances[sourceVertex] = 0;
+    for (std::size_t queueHead = 0; queueHead < vertexQueue.size(); ++queueHead) {
+        int currentVertex = vertexQueue[queueHead];
+        for (int neighbor : adjacencyList.adjacencyData[currentVertex]) {
+            if (vertexDistances[neighbor] == -1) {
+                vertexDistances[neighbor] = vertexDistances[currentVertex] + 1;
+                vertexQueue.push_back(neighbor);
+            }
+        }
+    }
+    return vertexDistances;
+}
+
+#ifndef _WIN32
+
+/**
+ * @brief Write a whole buffer to a blocking socket
+ * @param socketDescriptor Socket to write
+ * @param data Bytes to send
+ * @param byteCount Number of bytes
+ * @return True once every byte is sent, false if the peer went away
+ */
+bool sendAllBytes(int socketDescriptor, const void* data, std::size_t byteCount) {
+    const char* bytePointer = static_cast<const char*>(data);
+    while (byteCount > 0) {
+        ssize_t sentBytes = send(socketDescriptor, bytePointer, byteCount, 0);
+        if (sentBytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (sentBytes <= 0) {
+            return false;
+        }
+        bytePointer += sentBytes;
+        byteCount -= static_cast<std::size_t>(sentBytes);
+    }
+    return true;
+}
+
+/**
+ * @brief Read exactly byteCount bytes from a blocking socket
+ * @param socketDescriptor Socket to read
+ * @param data Destination buffer
+ * @param byteCount Number of bytes
+ * @return True once every byte arrived, false on end of stream or error
+ */
+bool receiveAllBytes(int socketDescriptor, void* data, std::size_t byteCount) {
+    char* bytePointer = static_cast<char*>(data);
+    while (byteCount > 0) {
+        ssize_t receivedBytes = recv(socketDescriptor, bytePointer, byteCount, 0);
+        if (receivedBytes < 0 && errno == EINTR) {
+            continue;
+        }
+        if (receivedBytes <= 0) {
+            return false;
+        }
+        bytePointer += receivedBytes;
+        byteCount -= static_cast<std::size_t>(receivedBytes);
+    }
+    return true;
+}
+
+/**
+ * @brief Send one vertex batch to every peer and receive one batch from every peer
+ * @details Each batch is framed as an int64 count followed by int32 global vertex ids. All peer sockets are
+ *          nonblocking and driven by one poll loop, so two workers sending large batches to each other never
+ *          wait on a full socket buffer while the other side is not reading.
+ * @param peerSockets Socket to every other worker, -1 for this worker itself
+ * @param outgoingBatches Vertices to send to each worker
+ * @return Vertices received from each worker, or an empty vector if a peer failed
+ */
+std::vector<std::vector<int>> exchangeVertexBatchesWithPeers(const std::vector<int>& peerSockets,
+                                                             const std::vector<std::vector<int>>& outgoingBatches) {
+    int workerCount = static_cast<int>(peerSockets.size());
+    std::vector<std::vector<char>> sendBuffers(workerCount);
+    std::vector<std::size_t> sentBytes(workerCount, 0);
+    std::vector<std::vector<char>> receiveBuffers(workerCount, std::vector<char>(sizeof(std::int64_t)));
+    std::vector<std::size_t> receivedBytes(workerCount, 0);
+    std::vector<bool> headerDecoded(workerCount, false);
+    std::vector<std::vector<int>> incomingBatches(workerCount);
+
+    int pendingTransfers = 0;
+    for (int peerIndex = 0; peerIndex < workerCount; ++peerIndex) {
+        if (peerSockets[peerIndex] < 0) {
+            continue;
+        }
+        std::int64_t batchSize = static_cast<std::int64_t>(outgoingBatches[peerIndex].size());
+        sendBuffers[peerIndex].resize(sizeof(batchSize) + outgoingBatches[peerIndex].size() * sizeof(std::int32_t));
+        std::memcpy(sendBuffers[peerIndex].data(), &batchSize, sizeof(batchSize));
+        if (batchSize > 0) {
+            std::memcpy(sendBuffers[peerIndex].data() + sizeof(batchSize), outgoingBatches[peerIndex].data(),
+                        outgoingBatches[peerIndex].size() * sizeof(std::int32_t));
+        }
+        pendingTransfers += 2;
+    }
+
+    std::vector<pollfd> pollEntries;
+    std::vector<int> peerOfEntry;
+    while (pendingTransfers > 0) {
+        pollEntries.clear();
+        peerOfEntry.clear();
+        for (int peerIndex = 0; peerIndex < workerCount; ++peerIndex) {
+            if (peerSockets[peerIndex] < 0) {
+                continue;
+            }
+            short wantedEvents = 0;
+            if (sentBytes[peerIndex] < sendBuffers[peerIndex].size()) wantedEvents |= POLLOUT;
+            if (receivedBytes[peerIndex] < receiveBuffers[peerIndex].size()) wantedEvents |= POLLIN;
+            if (wantedEvents != 0) {
+                pollEntries.push_back({peerSockets[peerIndex], wantedEvents, 0});
+                peerOfEntry.push_back(peerIndex);
+            }
+        }
+        if (poll(pollEntries.data(), static_cast<nfds_t>(pollEntries.size()), -1) < 0) {
+            if (errno == EINTR) continue;
+            return {};
+        }
+
+        for (std::size_t entryIndex = 0; entryIndex < pollEntries.size(); ++entryIndex) {
+            int peerIndex = peerOfEntry[entryIndex];
+            short readyEvents = pollEntries[entryIndex].revents;
+            if (readyEvents & POLLOUT) {
+                ssize_t written = send(peerSockets[peerIndex], sendBuffers[peerIndex].data() + sentBytes[peerIndex],
+                                       sendBuffers[peerIndex].size() - sentBytes[peerIndex], 0);
+                if (written < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR) {
+                    return {};
+                }
+                if (written > 0) {
+                    sentBytes[peerIndex] += static_cast<std::size_t>(written);
+                    if (sentBytes[peerIndex] == sendBuffers[peerIndex].size()) pendingTransfers--;
+                }
+            }
+            if (readyEvents & (POLLIN | POLLHUP | POLLERR)) {
+                if (receivedBytes[peerIndex] == receiveBuffers[peerIndex].size()) {
+                    continue;
+                }
+                ssize_t readCount = recv(peerSockets[peerIndex], receiveBuffers[peerIndex].data() + receivedBytes[peerIndex],
+                                         receiveBuffers[peerIndex].size() - receivedBytes[peerIndex], 0);
+                if (readCount == 0 || (readCount < 0 && errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR)) {
+                    return {};
+                }
+                if (readCount > 0) {
+                    receivedBytes[peerIndex] += static_cast<std::size_t>(readCount);
+                }
+                // The header tells how many ids follow; grow the buffer once it is complete
+                if (!headerDecoded[peerIndex] && receivedBytes[peerIndex] == sizeof(std::int64_t)) {
+                    std::int64_t batchSize = 0;
+                    std::memcpy(&batchSize, receiveBuffers[peerIndex].data(), sizeof(batchSize));
+                    if (batchSize < 0) {
+                        return {};
+                    }
+                    headerDecoded[peerIndex] = true;
+                    receiveBuffers[peerIndex].resize(sizeof(batchSize) + static_cast<std::size_t>(batchSize) * sizeof(std::int32_t));
+                }
+                if (headerDecoded[peerIndex] && receivedBytes[peerIndex] == receiveBuffers[peerIndex].size()) {
+                    std::size_t idCount = (receiveBuffers[peerIndex].size() - sizeof(std::int64_t)) / sizeof(std::int32_t);
+                    incomingBatches[peerIndex].resize(idCount);
+                    if (idCount > 0) {
+                        std::memcpy(incomingBatches[peerIndex].data(), receiveBuffers[peerIndex].data() + sizeof(std::int64_t),
+                                    idCount * sizeof(std::int32_t));
+                    }
+                    pendingTransfers--;
+                }
+            }
+        }
+    }
+    return incomingBatches;
+}
+
+/**
+ * @brief Body of one shard worker process
+ * @details Loads its shard file, then runs level-synchronous BFS: expand the local frontier, send newly reached
+ *          ghosts to their owners (each ghost at most once), merge the vertices received from peers, report the
+ *          next frontier size and the number of ids sent to the coordinator, and continue while it says so.
+ *          Finally streams (global id, distance) of every owned vertex to the coordinator.
+ * @param shardFileName Shard file owned by this worker, must hold the shard whose index is this worker's slot
+ * @param sourceVertex Global id of the BFS source
+ * @param peerSockets Socket to every other worker, -1 for this worker itself
+ * @param controlSocket Socket to the coordinator
+ * @return Process exit status
+ */
+int runShardTraversalWorker(const std::string& shardFileName, int sourceVertex, const std::vector<int>& peerSockets, int controlSocket) {
+    GraphShard graphShard = readGraphShardFromBinaryFile(shardFileName);
+    if (graphShard.shardCount != static_cast<int>(peerSockets.size())) {
+        return 1;
+    }
+    // Ghosts are routed by shard index, so a shard started in another worker's slot would lose them silently
+    if (peerSockets[graphShard.shardIndex] >= 0) {
+        std::cerr << "Error: Shard file " << shardFileName << " holds shard " << graphShard.shardIndex
+                  << ", which is not the shard of its worker" << std::endl;
+        return 1;
+    }
+    int ownedCount = graphShard.ownedCount();
+    const CompressedSparseRow& localGraph = graphShard.localGraph;
+    for (int peerSocket : peerSockets) {
+        if (peerSocket >= 0) {
+            fcntl(peerSocket, F_SETFL, fcntl(peerSocket, F_GETFL, 0) | O_NONBLOCK);
+        }
+    }
+
+    std::vector<int> localDistances(ownedCount, -1);
+    std::vector<char> ghostAlreadySent(graphShard.ghostVertices.size(), 0);
+    std::vector<int> currentFrontier;
+    std::vector<int> nextFrontier;
+    int sourceLocalId = findOwnedLocalId(graphShard, sourceVertex);
+    if (sourceLocalId >= 0) {
+        localDistances[sourceLocalId] = 0;
+        currentFrontier.push_back(sourceLocalId);
+    }
+
+    std::vector<std::vector<int>> outgoingBatches(graphShard.shardCount);
+    for (int levelIndex = 0;; ++levelIndex) {
+        for (std::vector<int>& outgoingBatch : outgoingBatches) {
+            outgoingBatch.clear();
+        }
+        nextFrontier.clear();
+        for (int localVertex : currentFrontier) {
+            for (int position = localGraph.rowOffsets[localVertex]; position < localGraph.rowOffsets[localVertex + 1]; ++position) {
+                int neighbor = localGraph.columnIndices[position];
+                if (neighbor < ownedCount) {
+                    if (localDistances[neighbor] == -1) {
+                        localDistances[neighbor] = levelIndex + 1;
+                        nextFrontier.push_back(neighbor);
+                    }
+                } else if (!ghostAlreadySent[neighbor - ownedCount]) {
+                    ghostAlreadySent[neighbor - ownedCount] = 1;
+                    outgoingBatches[graphShard.ghostOwners[neighbor - ownedCount]].push_back(graphShard.ghostVertices[neighbor - ownedCount]);
+                }
+            }
+        }
+
+        std::int64_t sentVertexCount = 0;
+        for (const std::vector<int>& outgoingBatch : outgoingBatches) {
+            sentVertexCount += static_cast<std::int64_t>(outgoingBatch.size());
+        }
+        std::vector<std::vector<int>> incomingBatches = exchangeVertexBatchesWithPeers(peerSockets, outgoingBatches);
+        if (incomingBatches.empty()) {
+            return 1;
+        }
+        for (const std::vector<int>& incomingBatch : incomingBatches) {
+            for (int globalVertex : incomingBatch) {
+                int localVertex = findOwnedLocalId(graphShard, globalVertex);
+                if (localVertex >= 0 && localDistances[localVertex] == -1) {
+                    localDistances[localVertex] = levelIndex + 1;
+                    nextFrontier.push_back(localVertex);
+                }
+            }
+        }
+        currentFrontier.swap(nextFrontier);
+
+        std::int64_t levelReport[2] = {static_cast<std::int64_t>(currentFrontier.size()), sentVertexCount};
+        std::int64_t continueTraversal = 0;
+        if (!sendAllBytes(controlSocket, levelReport, sizeof(levelReport)) ||
+            !receiveAllBytes(controlSocket, &continueTraversal, sizeof(continueTraversal))) {
+            return 1;
+        }
+        if (continueTraversal == 0) {
+            break;
+        }
+    }
+
+    std::int64_t resultCount = ownedCount;
+    if (!sendAllBytes(controlSocket, &resultCount, sizeof(resultCount)) ||
+        !sendAllBytes(controlSocket, graphShard.ownedVertices.data(), graphShard.ownedVertices.size() * sizeof(std::int32_t)) ||
+        !sendAllBytes(controlSocket, localDistances.data(), localDistances.size() * sizeof(std::int32_t))) {
+        return 1;
+    }
+    return 0;
+}
+
+#endif
+
+/**
+ * @brief Run breadth-first search over shard files with one local worker process per shard
+ * @details The coordinator forks one worker per shard file. Workers are connected pairwise by Unix stream
+ *          socket pairs and to the coordinator by one control socket each. After every level the coordinator
+ *          sums the next frontier sizes and tells the workers to stop once all are empty. Only shard files
+ *          and the final distances pass through this process; the graph itself is only loaded by the workers.
+ *          POSIX only; on Windows an error is printed and an empty result returned.
+ * @param shardFileNames Shard files, shardFileNames[s] holding shard s
+ * @param sourceVertex Global id of the BFS source
+ * @param numberOfVertices Number of vertices in the whole graph
+ * @return DistributedTraversalResult, with empty distances if a worker failed
+ */
+DistributedTraversalResult runDistributedBreadthFirstSearch(const std::vector<std::string>& shardFileNames, int sourceVertex,
+                                                            int numberOfVertices) {
+    DistributedTraversalResult traversalResult;
+#ifdef _WIN32
+    (void)shardFileNames;
+    (void)sourceVertex;
+    (void)numberOfVertices;
+    std::cerr << "Error: Distributed traversal needs POSIX processes and sockets" << std::endl;
+    return traversalResult;
+#else
+    int workerCount = static_cast<int>(shardFileNames.size());
+
+    // peerSockets[a][b] is the end of the a-b connection held by worker a
+    std::vector<std::vector<int>> peerSockets(workerCount, std::vector<int>(workerCount, -1));
+    std::vector<int> coordinatorSockets(workerCount, -1);
+    std::vector<int> workerControlSockets(workerCount, -1);
+    auto closeAllSockets = [&]() {
+        for (std::vector<int>& socketRow : peerSockets) {
+            for (int& socketDescriptor : socketRow) {
+                if (socketDescriptor >= 0) close(socketDescriptor);
+                socketDescriptor = -1;
+            }
+        }
+        for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+            if (coordinatorSockets[workerIndex] >= 0) close(coordinatorSockets[workerIndex]);
+            if (workerControlSockets[workerIndex] >= 0) close(workerControlSockets[workerIndex]);
+            coordinatorSockets[workerIndex] = -1;
+            workerControlSockets[workerIndex] = -1;
+        }
+    };
+    for (int firstWorker = 0; firstWorker < workerCount; ++firstWorker) {
+        int socketPair[2];
+        if (socketpair(AF_UNIX, SOCK_STREAM, 0, socketPair) != 0) {
+            std::cerr << "Error: Cannot create worker sockets" << std::endl;
+            closeAllSockets();
+            return traversalResult;
+        }
+        coordinatorSockets[firstWorker] = socketPair[0];
+        workerControlSockets[firstWorker] = socketPair[1];
+        for (int secondWorker = firstWorker + 1; secondWorker < workerCount; ++secondWorker) {
+            if (socketpair(AF_UNIX, SOCK_STREAM, 0, socketPair) != 0) {
+                std::cerr << "Error: Cannot create worker sockets" << std::endl;
+                closeAllSockets();
+                return traversalResult;
+            }
+            peerSockets[firstWorker][secondWorker] = socketPair[0];
+            peerSockets[secondWorker][firstWorker] = socketPair[1];
+        }
+    }
+
+    // A worker that dies mid-send must not take the coordinator down with SIGPIPE
+    struct sigaction ignorePipe;
+    struct sigaction previousPipeAction;
+    std::memset(&ignorePipe, 0, sizeof(ignorePipe));
+    ignorePipe.sa_handler = SIG_IGN;
+    sigaction(SIGPIPE, &ignorePipe, &previousPipeAction);
+
+    // Buffered output would otherwise be inherited, and printed again, by every worker
+    std::cout.flush();
+    std::cerr.flush();
+    std::vector<pid_t> workerProcesses;
+    for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+        pid_t processId = fork();
+        if (processId == 0) {
+            for (int otherWorker = 0; otherWorker < workerCount; ++otherWorker) {
+                close(coordinatorSockets[otherWorker]);
+                if (otherWorker != workerIndex) {
+                    close(workerControlSockets[otherWorker]);
+                    for (int socketDescriptor : peerSockets[otherWorker]) {
+                        if (socketDescriptor >= 0) close(socketDescriptor);
+                    }
+                }
+            }
+            int exitStatus = runShardTraversalWorker(shardFileNames[workerIndex], sourceVertex, peerSockets[workerIndex],
+                                                     workerControlSockets[workerIndex]);
+            _exit(exitStatus);
+        }
+        if (processId < 0) {
+            std::cerr << "Error: Cannot start worker process" << std::endl;
+            break;
+        }
+        workerProcesses.push_back(processId);
+    }
+
+    // The coordinator keeps only its ends of the control sockets
+    for (std::vector<int>& socketRow : peerSockets) {
+        for (int& socketDescriptor : socketRow) {
+            if (socketDescriptor >= 0) close(socketDescriptor);
+            socketDescriptor = -1;
+        }
+    }
+    for (int& socketDescriptor : workerControlSockets) {
+        close(socketDescriptor);
+        socketDescriptor = -1;
+    }
+
+    bool workersHealthy = static_cast<int>(workerProcesses.size()) == workerCount;
+    while (workersHealthy) {
+        std::int64_t nextFrontierTotal = 0;
+        for (int workerIndex = 0; workerIndex < workerCount && workersHealthy; ++workerIndex) {
+            std::int64_t levelReport[2];
+            workersHealthy = receiveAllBytes(coordinatorSockets[workerIndex], levelReport, sizeof(levelReport));
+            nextFrontierTotal += levelReport[0];
+            traversalResult.exchangedVertexCount += levelReport[1];
+        }
+        if (!workersHealthy) {
+            break;
+        }
+        traversalResult.levelCount++;
+        std::int64_t continueTraversal = nextFrontierTotal > 0 ? 1 : 0;
+        for (int workerIndex = 0; workerIndex < workerCount && workersHealthy; ++workerIndex) {
+            workersHealthy = sendAllBytes(coordinatorSockets[workerIndex], &continueTraversal, sizeof(continueTraversal));
+        }
+        if (continueTraversal == 0) {
+            break;
+        }
+    }
+
+    if (workersHealthy) {
+        traversalResult.vertexDistances.assign(numberOfVertices, -1);
+        for (int workerIndex = 0; workerIndex < workerCount && workersHealthy; ++workerIndex) {
+            std::int64_t resultCount = 0;
+            workersHealthy = receiveAllBytes(coordinatorSockets[workerIndex], &resultCount, sizeof(resultCount)) && resultCount >= 0;
+            std::vector<std::int32_t> ownedVertices(workersHealthy ? resultCount : 0);
+            std::vector<std::int32_t> ownedDistances(ownedVertices.size());
+            workersHealthy = workersHealthy &&
+                             receiveAllBytes(coordinatorSockets[workerIndex], ownedVertices.data(), ownedVertices.size() * sizeof(std::int32_t)) &&
+                             receiveAllBytes(coordinatorSockets[workerIndex], ownedDistances.data(), ownedDistances.size() * sizeof(std::int32_t));
+            for (std::size_t resultIndex = 0; workersHealthy && resultIndex < ownedVertices.size(); ++resultIndex) {
+                if (ownedVertices[resultIndex] >= 0 && ownedVertices[resultIndex] < numberOfVertices) {
+                    traversalResult.vertexDistances[ownedVertices[resultIndex]] = ownedDistances[resultIndex];
+                }
+            }
+        }
+    }
+
+    // Closing the control sockets unblocks any worker still waiting after a failure
+    closeAllSockets();
+    for (pid_t processId : workerProcesses) {
+        int processStatus = 0;
+        waitpid(processId, &processStatus, 0);
+        if (!WIFEXITED(processStatus) || WEXITSTATUS(processStatus) != 0) {
+            workersHealthy = false;
+        }
+    }
+    sigaction(SIGPIPE, &previousPipeAction, nullptr);
+
+    if (!workersHealthy) {
+        std::cerr << "Error: Distributed traversal worker failed" << std::endl;
+        return DistributedTraversalResult();
+    }
+    return traversalResult;
+#endif
+}
@@ -0,0 +1,291 @@
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Get the file name of a column type
+ * @param columnType The column type
+ * @return "integer", "real" or "label"
+ */
+std::string getPropertyColumnTypeName(PropertyColumnType columnType) {
+    switch (columnType) {
+        case PropertyColumnType::Integer: return "integer";
+        case PropertyColumnType::Real: return "real";
+        case PropertyColumnType::Label: return "label";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Add an edge property column to an extended adjacency list
+ * @param extendedList The extended adjacency list
+ * @param columnName Name of the column
+ * @param defaultValue Value of every existing edge
+ * @return Reference to the column, indexed by edge id
+ */
+template <typename ValueType>
+std::vector<ValueType>& addEdgePropertyColumn(ExtendedAdjacencyList& extendedList, const std::string& columnName,
+                                              const ValueType& defaultValue = ValueType()) {
+    if (extendedList.edgeProperties.rowCount != static_cast<int>(extendedList.edgeInstances.size())) {
+        resizePropertyRows(extendedList.edgeProperties, static_cast<int>(extendedList.edgeInstances.size()));
+    }
+    return addPropertyColumn(extendedList.edgeProperties, columnName, defaultValue);
+}
+
+/**
+ * @brief Add a vertex property column to an extended adjacency list
+ * @param extendedList The extended adjacency list
+ * @param columnName Name of the column
+ * @param defaultValue Value of every vertex
+ * @return Reference to the column, indexed by vertex id
+ */
+template <typename ValueType>
+std::vector<ValueType>& addVertexPropertyColumn(ExtendedAdjacencyList& extendedList, const std::string& columnName,
+                                                const ValueType& defaultValue = ValueType()) {
+    if (extendedList.vertexProperties.rowCount != extendedList.numberOfVertices) {
+        resizePropertyRows(extendedList.vertexProperties, extendedList.numberOfVertices);
+    }
+    return addPropertyColumn(extendedList.vertexProperties, columnName, defaultValue);
+}
+
+/**
+ * @brief Read extended adjacency list with edge property columns
+ * @details Format: "V E", then "K name1 type1 ... nameK typeK" with type integer, real or label,
+ *          then E lines "source target value1 ... valueK". Labels are single whitespace-free tokens.
+ *          Any other type name is an error.
+ * @param fileName Name of input file
+ * @return ExtendedAdjacencyList structure whose edgeProperties hold the listed columns
+ */
+ExtendedAdjacencyList readExtendedAdjacencyListWithEdgeProperties(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        exit(1);
+    }
+
+    int numberOfVertices, numberOfEdges, numberOfColumns;
+    inputFile >> numberOfVertices >> numberOfEdges >> numberOfColumns;
+
+    ExtendedAdjacencyList extendedList;
+    extendedList.numberOfVertices = numberOfVertices;
+    extendedList.numberOfEdges = numberOfEdges;
+    extendedList.incomingEdgeIndices.resize(numberOfVertices);
+    extendedList.outgoingEdgeIndices.resize(numberOfVertices);
+    extendedList.edgeInstances.reserve(numberOfEdges);
+    extendedList.edgeProperties.rowCount = numberOfEdges;
+
+    // Resolve every column once, so each edge line only appends to already located vectors
+    std::vector<PropertyColumnType> columnTypes(numberOfColumns);
+    std::vector<std::vector<long long>*> integerTargets(numberOfColumns, nullptr);
+    std::vector<std::vector<double>*> realTargets(numberOfColumns, nullptr);
+    std::vector<std::vector<std::string>*> labelTargets(numberOfColumns, nullptr);
+    for (int columnIndex = 0; columnIndex < numberOfColumns; ++columnIndex) {
+        std::string columnName, typeName;
+        inputFile >> columnName >> typeName;
+        if (typeName == "integer") {
+            columnTypes[columnIndex] = PropertyColumnType::Integer;
+            integerTargets[columnIndex] = &extendedList.edgeProperties.integerColumns[columnName];
+            integerTargets[columnIndex]->reserve(numberOfEdges);
+        } else if (typeName == "real") {
+            columnTypes[columnIndex] = PropertyColumnType::Real;
+            realTargets[columnIndex] = &extendedList.edgeProperties.realColumns[columnName];
+            realTargets[columnIndex]->reserve(numberOfEdges);
+        } else if (typeName == "label") {
+            columnTypes[columnIndex] = PropertyColumnType::Label;
+            labelTargets[columnIndex] = &extendedList.edgeProperties.labelColumns[columnName];
+            labelTargets[columnIndex]->reserve(numberOfEdges);
+        } else {
+            std::cerr << "Error: Unknown type " << typeName << " of edge property column " << columnName << " in file " << fileName << std::endl;
+            exit(1);
+        }
+    }
+
+    for (int edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        inputFile >> sourceVertex >> targetVertex;
+
+        extendedList.edgeInstances.push_back({sourceVertex, targetVertex});
+        extendedList.outgoingEdgeIndices[sourceVertex].push_back(edgeIndex);
+        extendedList.incomingEdgeIndices[targetVertex].push_back(edgeIndex);
+
+        for (int columnIndex = 0; columnIndex < numberOfColumns; ++columnIndex) {
+            if (columnTypes[columnIndex] == PropertyColumnType::Integer) {
+                long long integerValue = 0;
+                inputFile >> integerValue;
+                integerTargets[columnIndex]->push_back(integerValue);
+            } else if (columnTypes[columnIndex] == PropertyColumnType::Real) {
+                double realValue = 0.0;
+                inputFile >> realValue;
+                realTargets[columnIndex]->push_back(realValue);
+            } else {
+                std::string labelValue;
+                inputFile >> labelValue;
+                labelTargets[columnIndex]->push_back(labelValue);
+            }
+        }
+    }
+
+    inputFile.close();
+    return extendedList;
+}
+
+/**
+ * @brief Write extended adjacency list with its edge property columns in the format read back by
+ *        readExtendedAdjacencyListWithEdgeProperties
+ * @details Columns are written integer first, then real, then label, each group in name order
+ * @param extendedList The extended adjacency list to write
+ * @param fileName Name of output file
+ */
+void writeExtendedAdjacencyListWithEdgeProperties(const ExtendedAdjacencyList& extendedList, const std::string& fileName) {
+    std::ofstream outputFile(fileName);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return;
+    }
+
+    const PropertyColumnSet& edgeProperties = extendedList.edgeProperties;
+    outputFile << extendedList.numberOfVertices << " " << extendedList.edgeInstances.size() << std::endl;
+    outputFile << edgeProperties.columnCount();
+    for (const auto& column : edgeProperties.integerColumns) {
+        outputFile << " " << column.first << " " << getPropertyColumnTypeName(PropertyColumnType::Integer);
+    }
+    for (const auto& column : edgeProperties.realColumns) {
+        outputFile << " " << column.first << " " << getPropertyColumnTypeName(PropertyColumnType::Real);
+    }
+    for (const auto& column : edgeProperties.labelColumns) {
+        outputFile << " " << column.first << " " << getPropertyColumnTypeName(PropertyColumnType::Label);
+    }
+    outputFile << std::endl;
+
+    outputFile.precision(17);
+    for (int edgeIndex = 0; edgeIndex < static_cast<int>(extendedList.edgeInstances.size()); ++edgeIndex) {
+        outputFile << extendedList.edgeInstances[edgeIndex].first << " " << extendedList.edgeInstances[edgeIndex].second;
+        for (const auto& column : edgeProperties.integerColumns) {
+            outputFile << " " << column.second[edgeIndex];
+        }
+        for (const auto& column : edgeProperties.realColumns) {
+            outputFile << " " << column.second[edgeIndex];
+        }
+        for (const auto& column : edgeProperties.labelColumns) {
+            outputFile << " " << column.second[edgeIndex];
+        }
+        outputFile << std::endl;
+    }
+
+    outputFile.flush();
+    outputFile.close();
+}
+
+/**
+ * @brief Keep only the edges accepted by a predicate, carrying their property rows along
+ * @details Kept edges are renumbered densely in their original order; vertex ids and vertex properties are unchanged
+ * @param extendedList The extended adjacency list to filter
+ * @param keepEdge Called as keepEdge(edgeId), returns true to keep the edge
+ * @return Filtered ExtendedAdjacencyList
+ */
+template <typename EdgePredicate>
+ExtendedAdjacencyList filterExtendedAdjacencyListEdges(const ExtendedAdjacencyList& extendedList, EdgePredicate keepEdge) {
+    ExtendedAdjacencyList filteredList;
+    filteredList.numberOfVertices = extendedList.numberOfVertices;
+    filteredList.incomingEdgeIndices.resize(extendedList.numberOfVertices);
+    filteredList.outgoingEdgeIndices.resize(extendedList.numberOfVertices);
+    filteredList.vertexProperties = extendedList.vertexProperties;
+
+    std::vector<int> originalEdgeOfEdge;
+    for (int edgeIndex = 0; edgeIndex < static_cast<int>(extendedList.edgeInstances.size()); ++edgeIndex) {
+        if (!keepEdge(edgeIndex)) {
+            continue;
+        }
+        int newEdgeIndex = static_cast<int>(filteredList.edgeInstances.size());
+        filteredList.edgeInstances.push_back(extendedList.edgeInstances[edgeIndex]);
+        filteredList.outgoingEdgeIndices[extendedList.edgeInstances[edgeIndex].first].push_back(newEdgeIndex);
+        filteredList.incomingEdgeIndices[extendedList.edgeInstances[edgeIndex].second].push_back(newEdgeIndex);
+        originalEdgeOfEdge.push_back(edgeIndex);
+    }
+
+    filteredList.numberOfEdges = static_cast<int>(filteredList.edgeInstances.size());
+    filteredList.edgeProperties = gatherPropertyRows(extendedList.edgeProperties, originalEdgeOfEdge);
+    return filteredList;
+}
+
+/**
+ * @brief Convert extended adjacency list to CSR, permuting edge properties into CSR position order
+ * @details CSR position p holds the edge originalEdgeOfPosition[p]; csrEdgeProperties row p is that edge's row,
+ *          so a CSR scan can read a property column in lockstep with columnIndices
+ * @param extendedList The extended adjacency list
+ * @param csrEdgeProperties Receives the edge properties indexed by CSR position
+ * @return CompressedSparseRow structure containing the converted data
+ */
+CompressedSparseRow convertExtendedAdjacencyListToCompressedSparseRow(const ExtendedAdjacencyList& extendedList,
+                                                                      PropertyColumnSet& csrEdgeProperties) {
+    CompressedSparseRow csrGraph;
+    csrGraph.numberOfVertices = extendedList.numberOfVertices;
+    csrGraph.numberOfEdges = static_cast<int>(extendedList.edgeInstances.size());
+    csrGraph.rowOffsets.assign(extendedList.numberOfVertices + 1, 0);
+    csrGraph.columnIndices.reserve(extendedList.edgeInstances.size());
+
+    std::vector<int> originalEdgeOfPosition;
+    originalEdgeOfPosition.reserve(extendedList.edgeInstances.size());
+    for (int vertexIndex = 0; vertexIndex < extendedList.numberOfVertices; ++vertexIndex) {
+        for (int edgeIndex : extendedList.outgoingEdgeIndices[vertexIndex]) {
+            csrGraph.columnIndices.push_back(extendedList.edgeInstances[edgeIndex].second);
+            originalEdgeOfPosition.push_back(edgeIndex);
+        }
+        csrGraph.rowOffsets[vertexIndex + 1] = static_cast<int>(csrGraph.columnIndices.size());
+    }
+
+    csrEdgeProperties = gatherPropertyRows(extendedList.edgeProperties, originalEdgeOfPosition);
+    return csrGraph;
+}
+
+/**
+ * @brief Convert CSR with position-indexed edge properties back to extended adjacency list
+ * @details Edge ids become CSR positions, so the properties are copied without permutation
+ * @param csrGraph The CSR structure
+ * @param csrEdgeProperties Edge properties indexed by CSR position
+ * @return ExtendedAdjacencyList structure containing the converted data
+ */
+ExtendedAdjacencyList convertCompressedSparseRowToExtendedAdjacencyList(const CompressedSparseRow& csrGraph,
+                                                                        const PropertyColumnSet& csrEdgeProperties) {
+    ExtendedAdjacencyList extendedList;
+    extendedList.numberOfVertices = csrGraph.numberOfVertices;
+    extendedList.numberOfEdges = csrGraph.numberOfEdges;
+    extendedList.incomingEdgeIndices.resize(csrGraph.numberOfVertices);
+    extendedList.outgoingEdgeIndices.resize(csrGraph.numberOfVertices);
+    extendedList.edgeInstances.reserve(csrGraph.columnIndices.size());
+
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; ++vertexIndex) {
+        for (int position = csrGraph.rowOffsets[vertexIndex]; position < csrGraph.rowOffsets[vertexIndex + 1]; ++position) {
+            extendedList.edgeInstances.push_back({vertexIndex, csrGraph.columnIndices[position]});
+            extendedList.outgoingEdgeIndices[vertexIndex].push_back(position);
+            extendedList.incomingEdgeIndices[csrGraph.columnIndices[position]].push_back(position);
+        }
+    }
+
+    extendedList.edgeProperties = csrEdgeProperties;
+    return extendedList;
+}
+
+/**
+ * @brief Sum a real edge column over each vertex's outgoing edges
+ * @details Reads only outgoingEdgeIndices and the one column, never the other properties
+ * @param extendedList The extended adjacency list
+ * @param columnName Name of a real edge column, e.g. "weight"
+ * @return Weighted out-degree of every vertex, or an empty vector if the column does not exist
+ */
+std::vector<double> computeWeightedOutDegrees(const ExtendedAdjacencyList& extendedList, const std::string& columnName) {
+    const std::vector<double>* weightColumn = findPropertyColumn<double>(extendedList.edgeProperties, columnName);
+    if (weightColumn == nullptr) {
+        std::cerr << "Error: No real edge property column " << columnName << std::endl;
+        return std::vector<double>();
+    }
+
+    std::vector<double> weightedOutDegrees(extendedList.numberOfVertices, 0.0);
+    for (int vertexIndex = 0; vertexIndex < extendedList.numberOfVertices; ++vertexIndex) {
+        for (int edgeIndex : extendedList.outgoingEdgeIndices[vertexIndex]) {
+            weightedOutDegrees[vertexIndex] += (*weightColumn)[edgeIndex];
+        }
+    }
+    return weightedOutDegrees;
+}
@@ -0,0 +1,526 @@
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <queue>
+#include <algorithm>
+#include <cstdio>
+#include <cstdint>
+#include <cstring>
+#include <atomic>
+#ifdef _WIN32
+#include <process.h>
+#else
+#include <unistd.h>
+#endif
+
+/**
+ * @brief Smallest read buffer given to one run during a merge, limits the merge fan-in under small budgets
+ */
+const std::size_t EXTERNAL_MERGE_MIN_BUFFER_BYTES = 1 << 16;
+
+/**
+ * @brief Magic bytes at the start of a binary CSR file
+ */
+const char CSR_BINARY_MAGIC[8] = {'C', 'S', 'R', 'G', 'R', 'A', 'P', 'H'};
+
+/**
+ * @brief Settings for out-of-core conversions
+ */
+struct ExternalMemoryConfig {
+    std::size_t memoryBudgetBytes;
+    std::string temporaryDirectory;
+
+    /**
+     * @brief Constructor with budget and scratch location
+     * @param budgetBytes Memory allowed for sort buffers and merge buffers
+     * @param scratchDirectory Directory that receives the sorted run files
+     */
+    ExternalMemoryConfig(std::size_t budgetBytes = static_cast<std::size_t>(256) << 20,
+                         const std::string& scratchDirectory = ".")
+        : memoryBudgetBytes(budgetBytes), temporaryDirectory(scratchDirectory) {}
+};
+
+/**
+ * @brief One edge as stored in a sorted run, keyed by the vertex it is grouped under
+ */
+struct ExternalEdgeRecord {
+    int sortVertex;
+    int otherVertex;
+    long long edgeIndex;
+};
+
+/**
+ * @brief Order records by grouping vertex, then by input position so every group keeps input order
+ */
+inline bool compareExternalEdgeRecords(const ExternalEdgeRecord& leftRecord, const ExternalEdgeRecord& rightRecord) {
+    if (leftRecord.sortVertex != rightRecord.sortVertex) {
+        return leftRecord.sortVertex < rightRecord.sortVertex;
+    }
+    return leftRecord.edgeIndex < rightRecord.edgeIndex;
+}
+
+/**
+ * @brief Sorted run files produced from one scan of an edge list
+ */
+struct ExternalEdgeRuns {
+    std::vector<std::string> outgoingRunFiles;
+    std::vector<std::string> incomingRunFiles;
+    int numberOfVertices;
+    long long numberOfEdges;
+    long long invalidEdgeCount;
+};
+
+/**
+ * @brief Get the id of the running process
+ * @return Process id
+ */
+long getExternalRunProcessId() {
+#ifdef _WIN32
+    return static_cast<long>(_getpid());
+#else
+    return static_cast<long>(getpid());
+#endif
+}
+
+/**
+ * @brief Build a run file name inside the temporary directory
+ * @details The name carries the process id and a process-wide sequence number, so concurrent conversions, in this
+ *          process or in others sharing the directory, never open the same run file
+ * @param config External memory settings
+ * @param runTag Short tag identifying the run family
+ * @param runIndex Sequence number of the run
+ * @return Path of the run file
+ */
+std::string makeExternalRunFileName(const ExternalMemoryConfig& config, const std::string& runTag, int runIndex) {
+    static std::atomic<long long> runFileSequence(0);
+    return config.temporaryDirectory + "/edge_run_" + std::to_string(getExternalRunProcessId()) + "_" +
+           std::to_string(runFileSequence.fetch_add(1)) + "_" + runTag + "_" + std::to_string(runIndex) + ".bin";
+}
+
+/**
+ * @brief Sort a buffer of records and write it as a new run file
+ * @param recordBuffer Records to sort, cleared afterwards
+ * @param config External memory settings
+ * @param runTag Short tag identifying the run family
+ * @param runFiles List that receives the new run file name
+ */
+void flushSortedEdgeRun(std::vector<ExternalEdgeRecord>& recordBuffer, const ExternalMemoryConfig& config,
+                        const std::string& runTag, std::vector<std::string>& runFiles) {
+    if (recordBuffer.empty()) {
+        return;
+    }
+    std::sort(recordBuffer.begin(), recordBuffer.end(), compareExternalEdgeRecords);
+
+    std::string runFileName = makeExternalRunFileName(config, runTag, static_cast<int>(runFiles.size()));
+    std::ofstream runFile(runFileName, std::ios::binary);
+    if (!runFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << runFileName << std::endl;
+        exit(1);
+    }
+    runFile.write(reinterpret_cast<const char*>(recordBuffer.data()),
+                  static_cast<std::streamsize>(recordBuffer.size() * sizeof(ExternalEdgeRecord)));
+    runFile.close();
+
+    runFiles.push_back(runFileName);
+    recordBuffer.clear();
+}
+
+/**
+ * @brief Scan an edge list once and cut it into sorted run files that each fit the memory budget
+ * @param fileName Name of input file containing edge list
+ * @param config External memory settings
+ * @param includeIncomingRuns Also produce runs grouped by target vertex (halves the buffer of each family)
+ * @return ExternalEdgeRuns describing the run files and the graph size
+ */
+ExternalEdgeRuns generateSortedEdgeRuns(const std::string& fileName, const ExternalMemoryConfig& config,
+                                        bool includeIncomingRuns) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        exit(1);
+    }
+
+    ExternalEdgeRuns edgeRuns;
+    long long declaredEdgeCount;
+    inputFile >> edgeRuns.numberOfVertices >> declaredEdgeCount;
+    edgeRuns.numberOfEdges = 0;
+    edgeRuns.invalidEdgeCount = 0;
+
+    std::size_t bufferFamilies = includeIncomingRuns ? 2 : 1;
+    std::size_t recordsPerRun = std::max<std::size_t>(1, config.memoryBudgetBytes / bufferFamilies / sizeof(ExternalEdgeRecord));
+    std::vector<ExternalEdgeRecord> outgoingBuffer;
+    std::vector<ExternalEdgeRecord> incomingBuffer;
+    outgoingBuffer.reserve(recordsPerRun);
+    if (includeIncomingRuns) {
+        incomingBuffer.reserve(recordsPerRun);
+    }
+
+    for (long long edgeIndex = 0; edgeIndex < declaredEdgeCount; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        if (!(inputFile >> sourceVertex >> targetVertex)) {
+            break;
+        }
+        if (sourceVertex < 0 || sourceVertex >= edgeRuns.numberOfVertices ||
+            targetVertex < 0 || targetVertex >= edgeRuns.numberOfVertices) {
+            edgeRuns.invalidEdgeCount++;
+            continue;
+        }
+
+        long long acceptedIndex = edgeRuns.numberOfEdges++;
+        outgoingBuffer.push_back({sourceVertex, targetVertex, acceptedIndex});
+        if (outgoingBuffer.size() == recordsPerRun) {
+            flushSortedEdgeRun(outgoingBuffer, config, "out", edgeRuns.outgoingRunFiles);
+        }
+        if (includeIncomingRuns) {
+            incomingBuffer.push_back({targetVertex, sourceVertex, acceptedIndex});
+            if (incomingBuffer.size() == recordsPerRun) {
+                flushSortedEdgeRun(incomingBuffer, config, "in", edgeRuns.incomingRunFiles);
+            }
+        }
+    }
+    flushSortedEdgeRun(outgoingBuffer, config, "out", edgeRuns.outgoingRunFiles);
+    flushSortedEdgeRun(incomingBuffer, config, "in", edgeRuns.incomingRunFiles);
+
+    if (edgeRuns.invalidEdgeCount > 0) {
+        std::cout << "Warning: Skipped " << edgeRuns.invalidEdgeCount << " edges with out-of-range vertices" << std::endl;
+    }
+
+    inputFile.close();
+    return edgeRuns;
+}
+
+/**
+ * @brief Buffered sequential reader over one sorted run file
+ */
+struct EdgeRunReader {
+    std::ifstream runFile;
+    std::vector<ExternalEdgeRecord> recordBuffer;
+    std::size_t bufferPosition;
+    std::size_t bufferLength;
+
+    /**
+     * @brief Load the next block of records
+     * @return False when the run is exhausted
+     */
+    bool refill() {
+        runFile.read(reinterpret_cast<char*>(recordBuffer.data()),
+                     static_cast<std::streamsize>(recordBuffer.size() * sizeof(ExternalEdgeRecord)));
+        bufferLength = static_cast<std::size_t>(runFile.gcount()) / sizeof(ExternalEdgeRecord);
+        bufferPosition = 0;
+        return bufferLength > 0;
+    }
+};
+
+/**
+ * @brief Merge sorted run files in one pass and visit every record in global order
+ * @param runFiles Run files to merge, each already sorted
+ * @param memoryBudgetBytes Memory shared by the read buffers of all runs
+ * @param visitRecord Called as visitRecord(record) in (sortVertex, edgeIndex) order
+ */
+template <typename RecordVisitor>
+void mergeSortedEdgeRunsOnce(const std::vector<std::string>& runFiles, std::size_t memoryBudgetBytes,
+                             RecordVisitor visitRecord) {
+    std::size_t recordsPerBuffer = std::max<std::size_t>(
+        EXTERNAL_MERGE_MIN_BUFFER_BYTES / sizeof(ExternalEdgeRecord),
+        memoryBudgetBytes / (runFiles.size() + 1) / sizeof(ExternalEdgeRecord));
+
+    std::vector<EdgeRunReader> runReaders(runFiles.size());
+    auto runHeadIsGreater = [&](int leftRun, int rightRun) {
+        const EdgeRunReader& leftReader = runReaders[leftRun];
+        const EdgeRunReader& rightReader = runReaders[rightRun];
+        return compareExternalEdgeRecords(rightReader.recordBuffer[rightReader.bufferPosition],
+                                          leftReader.recordBuffer[leftReader.bufferPosition]);
+    };
+    std::priority_queue<int, std::vector<int>, decltype(runHeadIsGreater)> runHeap(runHeadIsGreater);
+
+    for (int runIndex = 0; runIndex < static_cast<int>(runFiles.size()); ++runIndex) {
+        runReaders[runIndex].runFile.open(runFiles[runIndex], std::ios::binary);
+        if (!runReaders[runIndex].runFile.is_open()) {
+            std::cerr << "Error: Cannot open file " << runFiles[runIndex] << std::endl;
+            exit(1);
+        }
+        runReaders[runIndex].recordBuffer.resize(recordsPerBuffer);
+        if (runReaders[runIndex].refill()) {
+            runHeap.push(runIndex);
+        }
+    }
+
+    while (!runHeap.empty()) {
+        int runIndex = runHeap.top();
+        runHeap.pop();
+        EdgeRunReader& runReader = runReaders[runIndex];
+        visitRecord(runReader.recordBuffer[runReader.bufferPosition]);
+        if (++runReader.bufferPosition < runReader.bufferLength || runReader.refill()) {
+            runHeap.push(runIndex);
+        }
+    }
+}
+
+/**
+ * @brief Largest number of runs merged at once under a memory budget
+ * @details mergeSortedEdgeRunsOnce gives each of k runs, plus one spare slot, a buffer of at least
+ *          EXTERNAL_MERGE_MIN_BUFFER_BYTES, so k + 1 such buffers must fit in the budget. Never below 2, so budgets
+ *          under three minimum buffers still make progress and use three minimum buffers.
+ * @param memoryBudgetBytes Memory shared by the read buffers of all runs
+ * @return Maximum merge fan-in
+ */
+std::size_t computeExternalMergeFanIn(std::size_t memoryBudgetBytes) {
+    std::size_t bufferSlots = memoryBudgetBytes / EXTERNAL_MERGE_MIN_BUFFER_BYTES;
+    return bufferSlots > 3 ? bufferSlots - 1 : 2;
+}
+
+/**
+ * @brief Merge any number of sorted runs, collapsing them in intermediate passes when the fan-in exceeds the budget
+ * @param runFiles Run files to merge, consumed and deleted by this call
+ * @param config External memory settings
+ * @param runTag Short tag identifying the run family
+ * @param visitRecord Called as visitRecord(record) in (sortVertex, edgeIndex) order
+ * @return Number of intermediate merge passes before the final one
+ */
+template <typename RecordVisitor>
+int mergeSortedEdgeRuns(std::vector<std::string> runFiles, const ExternalMemoryConfig& config,
+                        const std::string& runTag, RecordVisitor visitRecord) {
+    std::size_t maximumFanIn = computeExternalMergeFanIn(config.memoryBudgetBytes);
+    int mergePass = 0;
+
+    while (runFiles.size() > maximumFanIn) {
+        std::vector<std::string> mergedRunFiles;
+        std::string passTag = runTag + "_pass" + std::to_string(++mergePass);
+        for (std::size_t groupBegin = 0; groupBegin < runFiles.size(); groupBegin += maximumFanIn) {
+            std::size_t groupEnd = std::min(runFiles.size(), groupBegin + maximumFanIn);
+            std::vector<std::string> groupRunFiles(runFiles.begin() + groupBegin, runFiles.begin() + groupEnd);
+
+            std::string mergedRunFileName = makeExternalRunFileName(config, passTag, static_cast<int>(mergedRunFiles.size()));
+            std::ofstream mergedRunFile(mergedRunFileName, std::ios::binary);
+            if (!mergedRunFile.is_open()) {
+                std::cerr << "Error: Cannot create file " << mergedRunFileName << std::endl;
+                exit(1);
+            }
+            mergeSortedEdgeRunsOnce(groupRunFiles, config.memoryBudgetBytes, [&](const ExternalEdgeRecord& edgeRecord) {
+                mergedRunFile.write(reinterpret_cast<const char*>(&edgeRecord), sizeof(ExternalEdgeRecord));
+            });
+            mergedRunFile.close();
+            if (!mergedRunFile) {
+                std::cerr << "Error: Cannot write file " << mergedRunFileName << std::endl;
+                std::remove(mergedRunFileName.c_str());
+                exit(1);
+            }
+
+            for (const std::string& groupRunFile : groupRunFiles) {
+                std::remove(groupRunFile.c_str());
+            }
+            mergedRunFiles.push_back(mergedRunFileName);
+        }
+        runFiles.swap(mergedRunFiles);
+    }
+
+    mergeSortedEdgeRunsOnce(runFiles, config.memoryBudgetBytes, visitRecord);
+    for (const std::string& runFile : runFiles) {
+        std::remove(runFile.c_str());
+    }
+    return mergePass;
+}
+
+/**
+ * @brief Convert an edge list file to a binary CSR file without holding the graph in memory
+ * @details File layout: 8-byte magic, int64 vertex count, int64 edge count, int64 rowOffsets[V + 1],
+ *          int32 columnIndices[E]. Each row keeps the input order of its edges, parallel edges are repeated.
+ * @param inputFileName Name of input file containing edge list
+ * @param outputFileName Name of binary CSR file to create
+ * @param config External memory settings
+ * @param mergePassCount If not null, receives the number of intermediate merge passes
+ * @return Number of edges written, 0 if the file could not be written, in which case no partial file is left behind
+ */
+long long convertEdgeListToCompressedSparseRowFile(const std::string& inputFileName, const std::string& outputFileName,
+                                                   const ExternalMemoryConfig& config = ExternalMemoryConfig(),
+                                                   int* mergePassCount = nullptr) {
+    ExternalEdgeRuns edgeRuns = generateSortedEdgeRuns(inputFileName, config, false);
+    std::int64_t vertexCount = edgeRuns.numberOfVertices;
+    std::int64_t edgeCount = edgeRuns.numberOfEdges;
+    auto removeEdgeRuns = [&]() {
+        for (const std::string& runFile : edgeRuns.outgoingRunFiles) {
+            std::remove(runFile.c_str());
+        }
+    };
+
+    std::ofstream offsetStream(outputFileName, std::ios::binary);
+    if (!offsetStream.is_open()) {
+        std::cerr << "Error: Cannot create file " << outputFileName << std::endl;
+        removeEdgeRuns();
+        return 0;
+    }
+    offsetStream.write(CSR_BINARY_MAGIC, sizeof(CSR_BINARY_MAGIC));
+    offsetStream.write(reinterpret_cast<const char*>(&vertexCount), sizeof(vertexCount));
+    offsetStream.write(reinterpret_cast<const char*>(&edgeCount), sizeof(edgeCount));
+    offsetStream.flush();
+
+    // Offsets and columns are both produced in order, so each region gets its own sequential writer
+    std::fstream columnStream(outputFileName, std::ios::binary | std::ios::in | std::ios::out);
+    if (!columnStream.is_open()) {
+        std::cerr << "Error: Cannot open file " << outputFileName << std::endl;
+        offsetStream.close();
+        std::remove(outputFileName.c_str());
+        removeEdgeRuns();
+        return 0;
+    }
+    columnStream.seekp(static_cast<std::streamoff>(sizeof(CSR_BINARY_MAGIC) + 2 * sizeof(std::int64_t)
+                                                   + (vertexCount + 1) * sizeof(std::int64_t)));
+
+    std::int64_t emittedEdges = 0;
+    int nextRowVertex = 0;
+    auto emitRowOffsetsUpTo = [&](int rowVertex) {
+        for (; nextRowVertex <= rowVertex; ++nextRowVertex) {
+            offsetStream.write(reinterpret_cast<const char*>(&emittedEdges), sizeof(emittedEdges));
+        }
+    };
+
+    int intermediatePasses = mergeSortedEdgeRuns(edgeRuns.outgoingRunFiles, config, "out", [&](const ExternalEdgeRecord& edgeRecord) {
+        emitRowOffsetsUpTo(edgeRecord.sortVertex);
+        std::int32_t targetVertex = edgeRecord.otherVertex;
+        columnStream.write(reinterpret_cast<const char*>(&targetVertex), sizeof(targetVertex));
+        emittedEdges++;
+    });
+    emitRowOffsetsUpTo(edgeRuns.numberOfVertices);
+
+    columnStream.close();
+    offsetStream.close();
+    if (!columnStream || !offsetStream) {
+        std::cerr << "Error: Cannot write file " << outputFileName << std::endl;
+        std::remove(outputFileName.c_str());
+        return 0;
+    }
+    if (mergePassCount != nullptr) {
+        *mergePassCount = intermediatePasses;
+    }
+    return emittedEdges;
+}
+
+/**
+ * @brief Load a binary CSR file produced by convertEdgeListToCompressedSparseRowFile
+ * @param fileName Name of binary CSR file
+ * @return CompressedSparseRow structure, empty if the file is missing or malformed
+ */
+CompressedSparseRow readCompressedSparseRowFromBinaryFile(const std::string& fileName) {
+    CompressedSparseRow csrGraph;
+    csrGraph.numberOfVertices = 0;
+    csrGraph.numberOfEdges = 0;
+
+    std::ifstream inputFile(fileName, std::ios::binary);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return csrGraph;
+    }
+
+    char fileMagic[sizeof(CSR_BINARY_MAGIC)];
+    std::int64_t vertexCount = 0, edgeCount = 0;
+    inputFile.read(fileMagic, sizeof(fileMagic));
+    inputFile.read(reinterpret_cast<char*>(&vertexCount), sizeof(vertexCount));
+    inputFile.read(reinterpret_cast<char*>(&edgeCount), sizeof(edgeCount));
+    if (!inputFile || std::memcmp(fileMagic, CSR_BINARY_MAGIC, sizeof(CSR_BINARY_MAGIC)) != 0 ||
+        vertexCount < 0 || edgeCount < 0 || edgeCount > INT32_MAX) {
+        std::cerr << "Error: Invalid CSR file " << fileName << std::endl;
+        return csrGraph;
+    }
+
+    std::vector<std::int64_t> wideOffsets(vertexCount + 1);
+    std::vector<std::int32_t> columnValues(edgeCount);
+    inputFile.read(reinterpret_cast<char*>(wideOffsets.data()), static_cast<std::streamsize>(wideOffsets.size() * sizeof(std::int64_t)));
+    inputFile.read(reinterpret_cast<char*>(columnValues.data()), static_cast<std::streamsize>(columnValues.size() * sizeof(std::int32_t)));
+    if (!inputFile) {
+        std::cerr << "Error: Truncated CSR file " << fileName << std::endl;
+        return csrGraph;
+    }
+
+    csrGraph.numberOfVertices = static_cast<int>(vertexCount);
+    csrGraph.numberOfEdges = static_cast<int>(edgeCount);
+    csrGraph.rowOffsets.assign(wideOffsets.begin(), wideOffsets.end());
+    csrGraph.columnIndices.assign(columnValues.begin(), columnValues.end());
+    inputFile.close();
+    return csrGraph;
+}
+
+/**
+ * @brief Write one "Vertex v <label>: ..." section from a merged run family
+ * @param outputFile Output stream positioned at the section body
+ * @param runFiles Run files grouped by the section's vertex
+ * @param numberOfVertices Number of vertices in the graph
+ * @param sectionLabel Either "outgoing" or "incoming"
+ * @param config External memory settings
+ */
+void writeExternalEdgeIndexSection(std::ofstream& outputFile, const std::vector<std::string>& runFiles,
+                                   int numberOfVertices, const std::string& sectionLabel,
+                                   const ExternalMemoryConfig& config) {
+    int currentVertex = -1;
+    bool currentHasEdges = false;
+    auto advanceToVertex = [&](int targetVertex) {
+        while (currentVertex < targetVertex) {
+            if (currentVertex >= 0) {
+                outputFile << (currentHasEdges ? "" : "(none)") << '\n';
+            }
+            currentVertex++;
+            currentHasEdges = false;
+            if (currentVertex < numberOfVertices) {
+                outputFile << "Vertex " << currentVertex << " " << sectionLabel << ": ";
+            }
+        }
+    };
+
+    mergeSortedEdgeRuns(runFiles, config, sectionLabel, [&](const ExternalEdgeRecord& edgeRecord) {
+        advanceToVertex(edgeRecord.sortVertex);
+        outputFile << (currentHasEdges ? " " : "") << edgeRecord.edgeIndex;
+        currentHasEdges = true;
+    });
+    advanceToVertex(numberOfVertices);
+}
+
+/**
+ * @brief Convert an edge list file to the extended adjacency list output file without holding the graph in memory
+ * @details Produces the same text as writeExtendedAdjacencyListToFile. The input is read twice:
+ *          once to cut sorted runs by source and by target, once to copy the edge instances section.
+ * @param inputFileName Name of input file containing edge list
+ * @param outputFileName Name of output file
+ * @param config External memory settings
+ * @return Number of edges written
+ */
+long long convertEdgeListToExtendedAdjacencyListFile(const std::string& inputFileName, const std::string& outputFileName,
+                                                     const ExternalMemoryConfig& config = ExternalMemoryConfig()) {
+    ExternalEdgeRuns edgeRuns = generateSortedEdgeRuns(inputFileName, config, true);
+
+    std::ofstream outputFile(outputFileName);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << outputFileName << std::endl;
+        return 0;
+    }
+    outputFile << "=== Extended Adjacency List ===" << '\n';
+    outputFile << "Number of vertices: " << edgeRuns.numberOfVertices << '\n';
+    outputFile << "Number of edges: " << edgeRuns.numberOfEdges << '\n';
+
+    outputFile << "\nEdge instances:" << '\n';
+    std::ifstream inputFile(inputFileName);
+    long long declaredEdgeCount;
+    int ignoredVertexCount;
+    inputFile >> ignoredVertexCount >> declaredEdgeCount;
+    long long acceptedIndex = 0;
+    for (long long edgeIndex = 0; edgeIndex < declaredEdgeCount; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        if (!(inputFile >> sourceVertex >> targetVertex)) {
+            break;
+        }
+        if (sourceVertex < 0 || sourceVertex >= edgeRuns.numberOfVertices ||
+            targetVertex < 0 || targetVertex >= edgeRuns.numberOfVertices) {
+            continue;
+        }
+        outputFile << "Edge " << acceptedIndex++ << ": (" << sourceVertex << ", " << targetVertex << ")" << '\n';
+    }
+    inputFile.close();
+
+    outputFile << "\nOutgoing edges by vertex:" << '\n';
+    writeExternalEdgeIndexSection(outputFile, edgeRuns.outgoingRunFiles, edgeRuns.numberOfVertices, "outgoing", config);
+    outputFile << "\nIncoming edges by vertex:" << '\n';
+    writeExternalEdgeIndexSection(outputFile, edgeRuns.incomingRunFiles, edgeRuns.numberOfVertices, "incoming", config);
+
+    outputFile.flush();
+    outputFile.close();
+    return edgeRuns.numberOfEdges;
+}
@@ -0,0 +1,596 @@
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <cstring>
+#include <cstdio>
+#include <utility>
+
+const char SHARD_BINARY_MAGIC[8] = {'G', 'S', 'H', 'A', 'R', 'D', '0', '1'};
+
+/**
+ * @brief How vertices are assigned to partitions
+ */
+enum class PartitionStrategy {
+    Hash,
+    LabelPropagation
+};
+
+/**
+ * @brief Settings of the sharding stage
+ */
+struct PartitionConfig {
+    int partitionCount;
+    PartitionStrategy strategy;
+    int labelPropagationRounds;
+    double balanceSlack;
+
+    /**
+     * @brief Default constructor: two hash partitions
+     */
+    PartitionConfig() : partitionCount(2), strategy(PartitionStrategy::Hash), labelPropagationRounds(10), balanceSlack(0.1) {}
+};
+
+/**
+ * @brief One partition of a directed graph with the out-edges of its owned vertices
+ * @details Local ids 0..owned-1 are ownedVertices, local ids owned.. are ghostVertices, the non-owned
+ *          targets of owned edges. Both global id lists are sorted, so local ids are found by binary search.
+ *          localGraph has one row per owned vertex and columns in local ids.
+ */
+struct GraphShard {
+    int shardIndex;
+    int shardCount;
+    int numberOfGlobalVertices;
+    std::vector<int> ownedVertices;
+    std::vector<int> ghostVertices;
+    std::vector<int> ghostOwners;
+    CompressedSparseRow localGraph;
+
+    /**
+     * @brief Default constructor
+     */
+    GraphShard() : shardIndex(0), shardCount(0), numberOfGlobalVertices(0) {
+        localGraph.numberOfVertices = 0;
+        localGraph.numberOfEdges = 0;
+    }
+
+    /**
+     * @brief Number of owned vertices
+     * @return Owned vertex count
+     */
+    int ownedCount() const {
+        return static_cast<int>(ownedVertices.size());
+    }
+
+    /**
+     * @brief Map a local id back to its global id
+     * @param localVertex Owned or ghost local id
+     * @return Global vertex id
+     */
+    int globalIdOfLocal(int localVertex) const {
+        return localVertex < ownedCount() ? ownedVertices[localVertex] : ghostVertices[localVertex - ownedCount()];
+    }
+};
+
+/**
+ * @brief Result of partitioning a graph into shard files
+ */
+struct PartitionSummary {
+    std::vector<int> ownerOfVertex;
+    std::vector<int> shardVertexCounts;
+    std::vector<std::string> shardFileNames;
+    long long totalEdges;
+    long long cutEdges;
+
+    /**
+     * @brief Default constructor
+     */
+    PartitionSummary() : totalEdges(0), cutEdges(0) {}
+};
+
+/**
+ * @brief Find the local id of an owned vertex
+ * @param graphShard The shard
+ * @param globalVertex Global vertex id
+ * @return Local id, or -1 if the shard does not own the vertex
+ */
+int findOwnedLocalId(const GraphShard& graphShard, int globalVertex) {
+    auto ownedPosition = std::lower_bound(graphShard.ownedVertices.begin(), graphShard.ownedVertices.end(), globalVertex);
+    if (ownedPosition == graphShard.ownedVertices.end() || *ownedPosition != globalVertex) {
+        return -1;
+    }
+    return static_cast<int>(ownedPosition - graphShard.ownedVertices.begin());
+}
+
+/**
+ * @brief Edges buffered per shard before the streaming hash sharder appends them to the shard's temporary file
+ */
+const int SHARD_EDGE_BUFFER_SIZE = 1 << 16;
+
+/**
+ * @brief Owner partition of a vertex under hash partitioning
+ * @param vertexIndex Global vertex id
+ * @param partitionCount Number of partitions
+ * @return Partition index in [0, partitionCount)
+ */
+inline int getHashPartitionOwner(int vertexIndex, int partitionCount) {
+    return static_cast<int>(mixEdgeHash(static_cast<std::uint64_t>(vertexIndex)) % static_cast<std::uint64_t>(partitionCount));
+}
+
+/**
+ * @brief Assign every vertex to a partition by hashing its id
+ * @param numberOfVertices Number of vertices in the graph
+ * @param partitionCount Number of partitions
+ * @return Owner partition of every vertex
+ */
+std::vector<int> computeHashPartition(int numberOfVertices, int partitionCount) {
+    std::vector<int> ownerOfVertex(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        ownerOfVertex[vertexIndex] = getHashPartitionOwner(vertexIndex, partitionCount);
+    }
+    return ownerOfVertex;
+}
+
+/**
+ * @brief Refine a hash partition by size-constrained label propagation to cut fewer edges
+ * @details Each round moves every vertex to the partition most common among its in- and out-neighbors
+ *          (counting parallel edges), unless that partition already holds (1 + balanceSlack) * V / P vertices.
+ *          Stops early once a round moves nothing. Each round is O(V + E).
+ * @param adjacencyList The graph
+ * @param config Partition count, round limit and balance slack
+ * @return Owner partition of every vertex
+ */
+std::vector<int> computeLabelPropagationPartition(const AdjacencyList& adjacencyList, const PartitionConfig& config) {
+    int numberOfVertices = adjacencyList.numberOfVertices;
+    std::vector<int> ownerOfVertex = computeHashPartition(numberOfVertices, config.partitionCount);
+
+    // Incoming neighbors, so each vertex sees both directions of its edges
+    std::vector<std::vector<int>> incomingNeighbors(numberOfVertices);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyList.adjacencyData[sourceVertex]) {
+            incomingNeighbors[targetVertex].push_back(sourceVertex);
+        }
+    }
+
+    std::vector<int> partitionSizes(config.partitionCount, 0);
+    for (int owner : ownerOfVertex) {
+        partitionSizes[owner]++;
+    }
+    long long partitionCapacity = static_cast<long long>((1.0 + config.balanceSlack) * numberOfVertices / config.partitionCount) + 1;
+
+    std::vector<int> neighborLabelCounts(config.partitionCount, 0);
+    std::vector<int> touchedLabels;
+    for (int roundIndex = 0; roundIndex < config.labelPropagationRounds; ++roundIndex) {
+        int movedVertices = 0;
+        for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+            auto countLabel = [&](int neighbor) {
+                if (neighborLabelCounts[ownerOfVertex[neighbor]]++ == 0) {
+                    touchedLabels.push_back(ownerOfVertex[neighbor]);
+                }
+            };
+            for (int neighbor : adjacencyList.adjacencyData[vertexIndex]) {
+                countLabel(neighbor);
+            }
+            for (int neighbor : incomingNeighbors[vertexIndex]) {
+                countLabel(neighbor);
+            }
+
+            // Staying wins ties, so labels do not oscillate between equally good partitions
+            int currentLabel = ownerOfVertex[vertexIndex];
+            int bestLabel = currentLabel;
+            for (int label : touchedLabels) {
+                if (neighborLabelCounts[label] > neighborLabelCounts[bestLabel] && partitionSizes[label] < partitionCapacity) {
+                    bestLabel = label;
+                }
+            }
+            for (int label : touchedLabels) {
+                neighborLabelCounts[label] = 0;
+            }
+            touchedLabels.clear();
+
+            if (bestLabel != currentLabel) {
+                partitionSizes[currentLabel]--;
+                partitionSizes[bestLabel]++;
+                ownerOfVertex[vertexIndex] = bestLabel;
+                movedVertices++;
+            }
+        }
+        if (movedVertices == 0) {
+            break;
+        }
+    }
+    return ownerOfVertex;
+}
+
+/**
+ * @brief Count the edges whose endpoints lie in different partitions
+ * @param adjacencyList The graph
+ * @param ownerOfVertex Owner partition of every vertex
+ * @return Number of cut edge instances
+ */
+long long countPartitionEdgeCut(const AdjacencyList& adjacencyList, const std::vector<int>& ownerOfVertex) {
+    long long cutEdges = 0;
+    for (int sourceVertex = 0; sourceVertex < adjacencyList.numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyList.adjacencyData[sourceVertex]) {
+            if (ownerOfVertex[sourceVertex] != ownerOfVertex[targetVertex]) {
+                cutEdges++;
+            }
+        }
+    }
+    return cutEdges;
+}
+
+/**
+ * @brief Build one shard from the out-edges of its owned vertices
+ * @details Owned vertices are found by asking ownerOf for every global id, so no V-sized array is needed. Edges are
+ *          grouped by source with a stable counting sort, so each row keeps the input order of its edges. Memory is
+ *          O(owned + ghosts + shard edges).
+ * @param shardEdges (source, target) pairs whose source belongs to this shard, in input order
+ * @param numberOfGlobalVertices Number of vertices in the whole graph
+ * @param shardIndex Partition to build
+ * @param shardCount Number of partitions
+ * @param ownerOf Called as ownerOf(vertex), returns the owner partition of a global vertex
+ * @return GraphShard of that partition
+ */
+template <typename OwnerFunction>
+GraphShard buildGraphShardFromEdges(const std::vector<std::pair<int, int>>& shardEdges, int numberOfGlobalVertices,
+                                    int shardIndex, int shardCount, OwnerFunction ownerOf) {
+    GraphShard graphShard;
+    graphShard.shardIndex = shardIndex;
+    graphShard.shardCount = shardCount;
+    graphShard.numberOfGlobalVertices = numberOfGlobalVertices;
+    for (int vertexIndex = 0; vertexIndex < numberOfGlobalVertices; ++vertexIndex) {
+        if (ownerOf(vertexIndex) == shardIndex) {
+            graphShard.ownedVertices.push_back(vertexIndex);
+        }
+    }
+
+    for (const std::pair<int, int>& shardEdge : shardEdges) {
+        if (ownerOf(shardEdge.second) != shardIndex) {
+            graphShard.ghostVertices.push_back(shardEdge.second);
+        }
+    }
+    std::sort(graphShard.ghostVertices.begin(), graphShard.ghostVertices.end());
+    graphShard.ghostVertices.erase(std::unique(graphShard.ghostVertices.begin(), graphShard.ghostVertices.end()),
+                                   graphShard.ghostVertices.end());
+    for (int ghostVertex : graphShard.ghostVertices) {
+        graphShard.ghostOwners.push_back(ownerOf(ghostVertex));
+    }
+
+    CompressedSparseRow& localGraph = graphShard.localGraph;
+    localGraph.numberOfVertices = graphShard.ownedCount();
+    localGraph.rowOffsets.assign(graphShard.ownedCount() + 1, 0);
+    for (const std::pair<int, int>& shardEdge : shardEdges) {
+        localGraph.rowOffsets[findOwnedLocalId(graphShard, shardEdge.first) + 1]++;
+    }
+    for (int localVertex = 0; localVertex < graphShard.ownedCount(); ++localVertex) {
+        localGraph.rowOffsets[localVertex + 1] += localGraph.rowOffsets[localVertex];
+    }
+    localGraph.columnIndices.resize(shardEdges.size());
+    std::vector<int> fillPosition(localGraph.rowOffsets.begin(), localGraph.rowOffsets.end() - 1);
+    for (const std::pair<int, int>& shardEdge : shardEdges) {
+        int targetLocalId = findOwnedLocalId(graphShard, shardEdge.second);
+        if (targetLocalId < 0) {
+            targetLocalId = graphShard.ownedCount() +
+                            static_cast<int>(std::lower_bound(graphShard.ghostVertices.begin(), graphShard.ghostVertices.end(), shardEdge.second) -
+                                             graphShard.ghostVertices.begin());
+        }
+        localGraph.columnIndices[fillPosition[findOwnedLocalId(graphShard, shardEdge.first)]++] = targetLocalId;
+    }
+    localGraph.numberOfEdges = static_cast<int>(localGraph.columnIndices.size());
+    return graphShard;
+}
+
+/**
+ * @brief Cut one shard out of a partitioned in-memory graph
+ * @details Every edge is stored by the owner of its source; targets owned elsewhere become ghosts
+ * @param adjacencyList The graph
+ * @param ownerOfVertex Owner partition of every vertex
+ * @param shardIndex Partition to extract
+ * @param shardCount Number of partitions
+ * @return GraphShard of that partition
+ */
+GraphShard buildGraphShard(const AdjacencyList& adjacencyList, const std::vector<int>& ownerOfVertex, int shardIndex, int shardCount) {
+    std::vector<std::pair<int, int>> shardEdges;
+    for (int sourceVertex = 0; sourceVertex < adjacencyList.numberOfVertices; ++sourceVertex) {
+        if (ownerOfVertex[sourceVertex] != shardIndex) {
+            continue;
+        }
+        for (int targetVertex : adjacencyList.adjacencyData[sourceVertex]) {
+            shardEdges.push_back({sourceVertex, targetVertex});
+        }
+    }
+    return buildGraphShardFromEdges(shardEdges, adjacencyList.numberOfVertices, shardIndex, shardCount,
+                                    [&](int vertexIndex) { return ownerOfVertex[vertexIndex]; });
+}
+
+/**
+ * @brief Write a shard to a binary file
+ * @details File layout: 8-byte magic, int64 shard index, shard count, global vertex count, owned count, ghost count,
+ *          edge count, then int32 ownedVertices, int32 ghostVertices, int32 ghostOwners, int64 rowOffsets[owned + 1]
+ *          and int32 columnIndices[E] in local ids
+ * @param graphShard The shard to write
+ * @param fileName Name of binary shard file to create
+ * @return True on success
+ */
+bool writeGraphShardToBinaryFile(const GraphShard& graphShard, const std::string& fileName) {
+    std::ofstream outputFile(fileName, std::ios::binary);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return false;
+    }
+
+    std::int64_t headerValues[6] = {graphShard.shardIndex, graphShard.shardCount, graphShard.numberOfGlobalVertices,
+                                    graphShard.ownedCount(), static_cast<std::int64_t>(graphShard.ghostVertices.size()),
+                                    graphShard.localGraph.numberOfEdges};
+    std::vector<std::int64_t> wideOffsets(graphShard.localGraph.rowOffsets.begin(), graphShard.localGraph.rowOffsets.end());
+    outputFile.write(SHARD_BINARY_MAGIC, sizeof(SHARD_BINARY_MAGIC));
+    outputFile.write(reinterpret_cast<const char*>(headerValues), sizeof(headerValues));
+    outputFile.write(reinterpret_cast<const char*>(graphShard.ownedVertices.data()), static_cast<std::streamsize>(graphShard.ownedVertices.size() * sizeof(std::int32_t)));
+    outputFile.write(reinterpret_cast<const char*>(graphShard.ghostVertices.data()), static_cast<std::streamsize>(graphShard.ghostVertices.size() * sizeof(std::int32_t)));
+    outputFile.write(reinterpret_cast<const char*>(graphShard.ghostOwners.data()), static_cast<std::streamsize>(graphShard.ghostOwners.size() * sizeof(std::int32_t)));
+    outputFile.write(reinterpret_cast<const char*>(wideOffsets.data()), static_cast<std::streamsize>(wideOffsets.size() * sizeof(std::int64_t)));
+    outputFile.write(reinterpret_cast<const char*>(graphShard.localGraph.columnIndices.data()),
+                     static_cast<std::streamsize>(graphShard.localGraph.columnIndices.size() * sizeof(std::int32_t)));
+    outputFile.close();
+    if (!outputFile) {
+        std::cerr << "Error: Cannot write file " << fileName << std::endl;
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief Check the arrays of a shard file against its header before anything indexes with them
+ * @details Vertex lists must be strictly increasing global ids (lookups binary-search them), ghost owners must be
+ *          other shards, row offsets must be monotone from 0 to E and every column must be an owned or ghost local id
+ * @param headerValues Shard index, shard count, global vertex count, owned count, ghost count, edge count
+ * @param graphShard Shard holding the vertex lists and columns read from the file
+ * @param wideOffsets Row offsets read from the file
+ * @return True if the shard can be used safely
+ */
+bool isGraphShardDataConsistent(const std::int64_t* headerValues, const GraphShard& graphShard, const std::vector<std::int64_t>& wideOffsets) {
+    std::int64_t shardIndex = headerValues[0];
+    std::int64_t shardCount = headerValues[1];
+    std::int64_t numberOfGlobalVertices = headerValues[2];
+    if (shardCount <= 0 || shardCount > INT32_MAX || shardIndex < 0 || shardIndex >= shardCount ||
+        numberOfGlobalVertices < 0 || numberOfGlobalVertices > INT32_MAX) {
+        return false;
+    }
+    for (const std::vector<int>* vertexList : {&graphShard.ownedVertices, &graphShard.ghostVertices}) {
+        for (std::size_t position = 0; position < vertexList->size(); ++position) {
+            int globalVertex = (*vertexList)[position];
+            if (globalVertex < 0 || globalVertex >= numberOfGlobalVertices || (position > 0 && (*vertexList)[position - 1] >= globalVertex)) {
+                return false;
+            }
+        }
+    }
+    for (int ghostOwner : graphShard.ghostOwners) {
+        if (ghostOwner < 0 || ghostOwner >= shardCount || ghostOwner == shardIndex) {
+            return false;
+        }
+    }
+    if (wideOffsets.front() != 0 || wideOffsets.back() != headerValues[5]) {
+        return false;
+    }
+    for (std::size_t rowIndex = 1; rowIndex < wideOffsets.size(); ++rowIndex) {
+        if (wideOffsets[rowIndex] < wideOffsets[rowIndex - 1]) {
+            return false;
+        }
+    }
+    std::int64_t localVertexCount = headerValues[3] + headerValues[4];
+    for (int localVertex : graphShard.localGraph.columnIndices) {
+        if (localVertex < 0 || localVertex >= localVertexCount) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Load a binary shard file produced by writeGraphShardToBinaryFile
+ * @param fileName Name of binary shard file
+ * @return GraphShard structure, with no owned vertices if the file is missing, truncated or inconsistent
+ */
+GraphShard readGraphShardFromBinaryFile(const std::string& fileName) {
+    GraphShard graphShard;
+    std::ifstream inputFile(fileName, std::ios::binary);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return graphShard;
+    }
+
+    char fileMagic[sizeof(SHARD_BINARY_MAGIC)];
+    std::int64_t headerValues[6] = {0, 0, 0, 0, 0, 0};
+    inputFile.read(fileMagic, sizeof(fileMagic));
+    inputFile.read(reinterpret_cast<char*>(headerValues), sizeof(headerValues));
+    if (!inputFile || std::memcmp(fileMagic, SHARD_BINARY_MAGIC, sizeof(SHARD_BINARY_MAGIC)) != 0 ||
+        headerValues[3] < 0 || headerValues[3] > INT32_MAX || headerValues[4] < 0 || headerValues[4] > INT32_MAX ||
+        headerValues[5] < 0 || headerValues[5] > INT32_MAX) {
+        std::cerr << "Error: Invalid shard file " << fileName << std::endl;
+        return graphShard;
+    }
+
+    std::vector<std::int64_t> wideOffsets(headerValues[3] + 1);
+    graphShard.ownedVertices.resize(headerValues[3]);
+    graphShard.ghostVertices.resize(headerValues[4]);
+    graphShard.ghostOwners.resize(headerValues[4]);
+    graphShard.localGraph.columnIndices.resize(headerValues[5]);
+    inputFile.read(reinterpret_cast<char*>(graphShard.ownedVertices.data()), static_cast<std::streamsize>(graphShard.ownedVertices.size() * sizeof(std::int32_t)));
+    inputFile.read(reinterpret_cast<char*>(graphShard.ghostVertices.data()), static_cast<std::streamsize>(graphShard.ghostVertices.size() * sizeof(std::int32_t)));
+    inputFile.read(reinterpret_cast<char*>(graphShard.ghostOwners.data()), static_cast<std::streamsize>(graphShard.ghostOwners.size() * sizeof(std::int32_t)));
+    inputFile.read(reinterpret_cast<char*>(wideOffsets.data()), static_cast<std::streamsize>(wideOffsets.size() * sizeof(std::int64_t)));
+    inputFile.read(reinterpret_cast<char*>(graphShard.localGraph.columnIndices.data()),
+                   static_cast<std::streamsize>(graphShard.localGraph.columnIndices.size() * sizeof(std::int32_t)));
+    if (!inputFile) {
+        std::cerr << "Error: Truncated shard file " << fileName << std::endl;
+        return GraphShard();
+    }
+
+    if (!isGraphShardDataConsistent(headerValues, graphShard, wideOffsets)) {
+        std::cerr << "Error: Invalid shard file " << fileName << std::endl;
+        return GraphShard();
+    }
+
+    graphShard.shardIndex = static_cast<int>(headerValues[0]);
+    graphShard.shardCount = static_cast<int>(headerValues[1]);
+    graphShard.numberOfGlobalVertices = static_cast<int>(headerValues[2]);
+    graphShard.localGraph.numberOfVertices = static_cast<int>(headerValues[3]);
+    graphShard.localGraph.numberOfEdges = static_cast<int>(headerValues[5]);
+    graphShard.localGraph.rowOffsets.assign(wideOffsets.begin(), wideOffsets.end());
+    inputFile.close();
+    return graphShard;
+}
+
+/**
+ * @brief Write every shard in turn, removing all shard files again if one cannot be written
+ * @param partitionSummary Receives the shard file names and sizes
+ * @param shardFilePrefix Path prefix of the shard files
+ * @param shardCount Number of partitions
+ * @param buildShard Called as buildShard(shardIndex), returns the GraphShard of that partition
+ * @return True if every shard file was written
+ */
+template <typename ShardBuilder>
+bool writeAllGraphShards(PartitionSummary& partitionSummary, const std::string& shardFilePrefix, int shardCount, ShardBuilder buildShard) {
+    for (int shardIndex = 0; shardIndex < shardCount; ++shardIndex) {
+        GraphShard graphShard = buildShard(shardIndex);
+        std::string shardFileName = shardFilePrefix + "_" + std::to_string(shardIndex) + ".shard";
+        partitionSummary.shardFileNames.push_back(shardFileName);
+        if (!writeGraphShardToBinaryFile(graphShard, shardFileName)) {
+            for (const std::string& writtenFileName : partitionSummary.shardFileNames) {
+                std::remove(writtenFileName.c_str());
+            }
+            partitionSummary.shardFileNames.clear();
+            partitionSummary.shardVertexCounts.clear();
+            return false;
+        }
+        partitionSummary.shardVertexCounts.push_back(graphShard.ownedCount());
+    }
+    return true;
+}
+
+/**
+ * @brief Hash-shard an edge list file without loading the whole graph
+ * @details One pass streams every edge to a temporary file of its source's shard
+ *          ("<shardFilePrefix>_<s>.edges"). Each shard is then built from its own file alone, so peak memory is one
+ *          shard plus the per-shard write buffers. Edges with an endpoint outside [0, V) are skipped.
+ * @param inputFileName Name of input file containing edge list
+ * @param shardFilePrefix Path prefix of the shard and temporary files
+ * @param partitionCount Number of partitions
+ * @return PartitionSummary with shard sizes, file names and edge cut; ownerOfVertex stays empty, use
+ *         getHashPartitionOwner. No file names on failure.
+ */
+PartitionSummary partitionEdgeListByHashIntoShardFiles(const std::string& inputFileName, const std::string& shardFilePrefix,
+                                                       int partitionCount) {
+    typedef std::pair<int, int> ShardEdge;
+    PartitionSummary partitionSummary;
+    std::ifstream inputFile(inputFileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << inputFileName << std::endl;
+        return partitionSummary;
+    }
+    int numberOfVertices = 0;
+    long long numberOfEdges = 0;
+    inputFile >> numberOfVertices >> numberOfEdges;
+
+    std::vector<std::string> edgeFileNames;
+    std::vector<std::ofstream> edgeFiles;
+    for (int shardIndex = 0; shardIndex < partitionCount; ++shardIndex) {
+        edgeFileNames.push_back(shardFilePrefix + "_" + std::to_string(shardIndex) + ".edges");
+        edgeFiles.emplace_back(edgeFileNames.back(), std::ios::binary);
+    }
+    auto removeEdgeFiles = [&]() {
+        for (std::ofstream& edgeFile : edgeFiles) {
+            edgeFile.close();
+        }
+        for (const std::string& edgeFileName : edgeFileNames) {
+            std::remove(edgeFileName.c_str());
+        }
+    };
+    std::vector<std::vector<ShardEdge>> edgeBuffers(partitionCount);
+    auto flushEdgeBuffer = [&](int shardIndex) {
+        edgeFiles[shardIndex].write(reinterpret_cast<const char*>(edgeBuffers[shardIndex].data()),
+                                    static_cast<std::streamsize>(edgeBuffers[shardIndex].size() * sizeof(ShardEdge)));
+        edgeBuffers[shardIndex].clear();
+    };
+
+    for (long long edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        if (!(inputFile >> sourceVertex >> targetVertex)) {
+            break;
+        }
+        if (sourceVertex < 0 || sourceVertex >= numberOfVertices || targetVertex < 0 || targetVertex >= numberOfVertices) {
+            continue;
+        }
+        int sourceOwner = getHashPartitionOwner(sourceVertex, partitionCount);
+        partitionSummary.totalEdges++;
+        if (sourceOwner != getHashPartitionOwner(targetVertex, partitionCount)) {
+            partitionSummary.cutEdges++;
+        }
+        edgeBuffers[sourceOwner].push_back({sourceVertex, targetVertex});
+        if (static_cast<int>(edgeBuffers[sourceOwner].size()) == SHARD_EDGE_BUFFER_SIZE) {
+            flushEdgeBuffer(sourceOwner);
+        }
+    }
+    bool edgeFilesWritten = true;
+    for (int shardIndex = 0; shardIndex < partitionCount; ++shardIndex) {
+        flushEdgeBuffer(shardIndex);
+        edgeFiles[shardIndex].close();
+        if (!edgeFiles[shardIndex]) {
+            std::cerr << "Error: Cannot write file " << edgeFileNames[shardIndex] << std::endl;
+            edgeFilesWritten = false;
+        }
+    }
+    if (!edgeFilesWritten) {
+        removeEdgeFiles();
+        return partitionSummary;
+    }
+
+    writeAllGraphShards(partitionSummary, shardFilePrefix, partitionCount, [&](int shardIndex) {
+        std::vector<ShardEdge> shardEdges;
+        std::ifstream edgeFile(edgeFileNames[shardIndex], std::ios::binary | std::ios::ate);
+        shardEdges.resize(static_cast<std::size_t>(edgeFile.tellg()) / sizeof(ShardEdge));
+        edgeFile.seekg(0);
+        edgeFile.read(reinterpret_cast<char*>(shardEdges.data()), static_cast<std::streamsize>(shardEdges.size() * sizeof(ShardEdge)));
+        return buildGraphShardFromEdges(shardEdges, numberOfVertices, shardIndex, partitionCount,
+                                        [&](int vertexIndex) { return getHashPartitionOwner(vertexIndex, partitionCount); });
+    });
+    removeEdgeFiles();
+    return partitionSummary;
+}
+
+/**
+ * @brief Split an edge list file into P shard files
+ * @details Shard s is written to "<shardFilePrefix>_<s>.shard". Hash partitioning streams the edge list through
+ *          partitionEdgeListByHashIntoShardFiles and never holds the whole graph. Label propagation needs every
+ *          vertex's neighbors in both directions, so it still loads the whole graph plus an incoming-neighbor copy
+ *          into memory.
+ * @param inputFileName Name of input file containing edge list
+ * @param shardFilePrefix Path prefix of the shard files
+ * @param config Partition count and strategy
+ * @return PartitionSummary with the shard sizes, file names and edge cut, plus the owner map for label propagation;
+ *         no file names if partitionCount is not positive or a shard file could not be written, in which case the
+ *         files already written are removed
+ */
+PartitionSummary partitionEdgeListIntoShardFiles(const std::string& inputFileName, const std::string& shardFilePrefix,
+                                                 const PartitionConfig& config = PartitionConfig()) {
+    if (config.partitionCount <= 0) {
+        std::cerr << "Error: Partition count must be positive, got " << config.partitionCount << std::endl;
+        return PartitionSummary();
+    }
+    if (config.strategy == PartitionStrategy::Hash) {
+        return partitionEdgeListByHashIntoShardFiles(inputFileName, shardFilePrefix, config.partitionCount);
+    }
+
+    PartitionSummary partitionSummary;
+    AdjacencyList adjacencyList = readAdjacencyListFromEdgeList(inputFileName);
+    partitionSummary.ownerOfVertex = computeLabelPropagationPartition(adjacencyList, config);
+    partitionSummary.totalEdges = countTotalEdgesInAdjacencyList(adjacencyList);
+    partitionSummary.cutEdges = countPartitionEdgeCut(adjacencyList, partitionSummary.ownerOfVertex);
+    writeAllGraphShards(partitionSummary, shardFilePrefix, config.partitionCount, [&](int shardIndex) {
+        return buildGraphShard(adjacencyList, partitionSummary.ownerOfVertex, shardIndex, config.partitionCount);
+    });
+    return partitionSummary;
+}
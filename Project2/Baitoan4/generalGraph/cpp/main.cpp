@@ -1,10 +1,30 @@
+#include "display_summary.cpp"
+#include "property_columns.cpp"
 #include "adjacency_matrix.cpp"
 #include "adjacency_list.cpp"
 #include "extended_adjacency_list.cpp"
 #include "adjacency_map.cpp"
+#include "compressed_sparse_row.cpp"
+#include "edge_property_columns.cpp"
+#include "compact_multiplicity_matrix.cpp"
+#include "parallel_for.cpp"
+#include "streaming_statistics.cpp"
+#include "external_memory_conversion.cpp"
+#include "graph_fingerprint.cpp"
+#include "subgraph_extraction.cpp"
+#include "link_analysis.cpp"
+#include "graph_partitioning.cpp"
+#include "distributed_traversal.cpp"
+#include "transitive_closure.cpp"
 #include <iostream>
+#include <vector>
 #include <fstream>
 #include <string>
+#include <algorithm>
+#include <sstream>
+#include <cstdio>
+#include <chrono>
+#include <random>
 
 
 /**
@@ -163,6 +183,458 @@ void testMatrixInputFormat() {
     displayAdjacencyList(listFromMatrix);
 }
 
+/**
+ * @brief Test streaming matrix reader that skips zero cells instead of allocating V x V
+ */
+void testSparseMatrixReader() {
+    std::cout << "\n=== Testing Sparse Matrix Reader ===" << std::endl;
+    
+    CompressedSparseRow csrFromFile = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into CSR:" << std::endl;
+    displayCompressedSparseRow(csrFromFile);
+    
+    AdjacencyList listFromFile = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into Adjacency List:" << std::endl;
+    displayAdjacencyList(listFromFile);
+}
+
+/**
+ * @brief Test one-pass statistics over the edge list without building any representation
+ */
+void testStreamingStatistics() {
+    std::cout << "\n=== Testing Streaming Statistics ===" << std::endl;
+    
+    StreamingGraphStatistics exactStatistics = computeStreamingGraphStatistics("input.txt");
+    displayStreamingGraphStatistics(exactStatistics);
+    
+    StreamingGraphStatistics sketchStatistics = computeStreamingGraphStatistics("input.txt", true);
+    std::cout << "Same input with sketches forced:" << std::endl;
+    displayStreamingGraphStatistics(sketchStatistics);
+}
+
+/**
+ * @brief Read a whole text file into a string for comparison
+ * @param fileName Name of file to read
+ * @return File contents
+ */
+std::string readWholeFile(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    std::stringstream fileContents;
+    fileContents << inputFile.rdbuf();
+    return fileContents.str();
+}
+
+/**
+ * @brief Test out-of-core conversions with a tiny budget so several runs and merge passes are exercised
+ * @details A 64-byte budget cuts runs of 4 records and allows a merge fan-in of 2, so the 15 edges of input.txt give
+ *          4 runs and need one intermediate merge pass
+ */
+void testExternalMemoryConversion() {
+    std::cout << "\n=== Testing External Memory Conversion ===" << std::endl;
+    
+    ExternalMemoryConfig tinyBudgetConfig(64, ".");
+    int mergePassCount = 0;
+    long long csrEdges = convertEdgeListToCompressedSparseRowFile("input.txt", "external_graph.csr", tinyBudgetConfig, &mergePassCount);
+    CompressedSparseRow csrFromFile = readCompressedSparseRowFromBinaryFile("external_graph.csr");
+    std::cout << "Binary CSR written with " << csrEdges << " edges, intermediate merge passes: " << mergePassCount
+              << ", read back:" << std::endl;
+    displayCompressedSparseRow(csrFromFile);
+    
+    AdjacencyList listInMemory = readAdjacencyListFromEdgeList("input.txt");
+    bool csrMatches = csrFromFile.numberOfVertices == listInMemory.numberOfVertices;
+    for (int vertexIndex = 0; csrMatches && vertexIndex < csrFromFile.numberOfVertices; ++vertexIndex) {
+        std::vector<int> rowNeighbors(csrFromFile.columnIndices.begin() + csrFromFile.rowOffsets[vertexIndex],
+                                      csrFromFile.columnIndices.begin() + csrFromFile.rowOffsets[vertexIndex + 1]);
+        csrMatches = rowNeighbors == listInMemory.adjacencyData[vertexIndex];
+    }
+    std::cout << "CSR matches in-memory adjacency list: " << (csrMatches ? "yes" : "no") << std::endl;
+    
+    convertEdgeListToExtendedAdjacencyListFile("input.txt", "external_extended.txt", tinyBudgetConfig);
+    writeExtendedAdjacencyListToFile(readExtendedAdjacencyListFromEdgeList("input.txt"), "memory_extended.txt");
+    bool extendedMatches = readWholeFile("external_extended.txt") == readWholeFile("memory_extended.txt");
+    std::cout << "Extended list file matches in-memory writer: " << (extendedMatches ? "yes" : "no") << std::endl;
+    
+    std::remove("external_graph.csr");
+    std::remove("external_extended.txt");
+    std::remove("memory_extended.txt");
+}
+
+/**
+ * @brief Test summary display on a generated graph too large for a readable full dump
+ */
+void testSummaryDisplay() {
+    std::cout << "\n=== Testing Summary Display ===" << std::endl;
+    
+    // Every third vertex links to hub 0, the rest get a spread of 0-8 targets
+    const int GENERATED_VERTEX_COUNT = 2000;
+    std::vector<std::vector<int>> generatedData(GENERATED_VERTEX_COUNT);
+    for (int sourceVertex = 1; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        if (sourceVertex % 3 == 0) {
+            generatedData[sourceVertex].push_back(0);
+        }
+        for (int targetRank = 0; targetRank < sourceVertex % 9; ++targetRank) {
+            generatedData[sourceVertex].push_back((sourceVertex * 7 + targetRank * 13 + 1) % GENERATED_VERTEX_COUNT);
+        }
+    }
+    
+    AdjacencyMatrix generatedMatrix = convertAdjacencyListToMatrix(generatedData, GENERATED_VERTEX_COUNT);
+    AdjacencyList generatedList = convertMatrixToAdjacencyList(generatedMatrix.matrixData, GENERATED_VERTEX_COUNT);
+    ExtendedAdjacencyList generatedExtended = convertAdjacencyListToExtended(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    AdjacencyMap generatedMap = convertAdjacencyListToMap(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    CompressedSparseRow generatedCsr;
+    generatedCsr.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedCsr.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& neighbors : generatedList.adjacencyData) {
+        generatedCsr.columnIndices.insert(generatedCsr.columnIndices.end(), neighbors.begin(), neighbors.end());
+        generatedCsr.rowOffsets.push_back(static_cast<int>(generatedCsr.columnIndices.size()));
+    }
+    generatedCsr.numberOfEdges = static_cast<int>(generatedCsr.columnIndices.size());
+    
+    // Automatic mode switches to the summary above FULL_DISPLAY_VERTEX_LIMIT vertices
+    displayAdjacencyMatrix(generatedMatrix);
+    displayAdjacencyList(generatedList);
+    displayExtendedAdjacencyList(generatedExtended);
+    displayAdjacencyMap(generatedMap);
+    displayCompressedSparseRow(generatedCsr);
+    
+    std::cout << "Small input forced into summary mode:" << std::endl;
+    displayAdjacencyList(readAdjacencyListFromEdgeList("input.txt"), GraphDisplayMode::Summary);
+}
+
+/**
+ * @brief Test byte-per-cell multiplicity matrix, its spill table and conversions against the int matrix
+ */
+void testCompactMultiplicityMatrix() {
+    std::cout << "\n=== Testing Compact Multiplicity Matrix ===" << std::endl;
+    
+    CompactMultiplicityMatrix compactFromFile = readCompactMultiplicityMatrixFromEdgeList("input.txt");
+    displayCompactMultiplicityMatrix(compactFromFile);
+    
+    AdjacencyMatrix referenceMatrix = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList referenceList = convertMatrixToAdjacencyList(referenceMatrix.matrixData, referenceMatrix.numberOfVertices);
+    bool matrixMatches = convertCompactMatrixToMatrix(compactFromFile).matrixData == referenceMatrix.matrixData;
+    bool listMatches = convertCompactMatrixToAdjacencyList(compactFromFile).adjacencyData == referenceList.adjacencyData;
+    CompressedSparseRow csrFromCompact = convertCompactMatrixToCompressedSparseRow(compactFromFile);
+    bool csrMatches = csrFromCompact.numberOfEdges == compactFromFile.numberOfEdges;
+    for (int vertexIndex = 0; csrMatches && vertexIndex < csrFromCompact.numberOfVertices; ++vertexIndex) {
+        csrMatches = std::vector<int>(csrFromCompact.columnIndices.begin() + csrFromCompact.rowOffsets[vertexIndex],
+                                      csrFromCompact.columnIndices.begin() + csrFromCompact.rowOffsets[vertexIndex + 1]) ==
+                     referenceList.adjacencyData[vertexIndex];
+    }
+    CompactMultiplicityMatrix compactFromList = convertAdjacencyListToCompactMatrix(referenceList.adjacencyData, referenceList.numberOfVertices);
+    bool roundTripMatches = compactFromList.cellData == compactFromFile.cellData;
+    std::cout << "Compact -> Matrix matches int matrix: " << (matrixMatches ? "yes" : "no") << std::endl;
+    std::cout << "Compact -> List matches Matrix -> List: " << (listMatches ? "yes" : "no") << std::endl;
+    std::cout << "Compact -> CSR matches Matrix -> List: " << (csrMatches ? "yes" : "no") << std::endl;
+    std::cout << "List -> Compact matches file reader: " << (roundTripMatches ? "yes" : "no") << std::endl;
+    
+    // Push one cell past a byte so it moves into the spill table
+    CompactMultiplicityMatrix spillMatrix(20);
+    for (int edgeRepeat = 0; edgeRepeat < 300; ++edgeRepeat) {
+        incrementCompactMultiplicity(spillMatrix, 1, 2);
+    }
+    addCompactMultiplicity(spillMatrix, 1, 17, 1000);
+    incrementCompactMultiplicity(spillMatrix, 1, 5);
+    std::cout << "Multiplicity (1,2) after 300 increments: " << getCompactMultiplicity(spillMatrix, 1, 2) << std::endl;
+    std::cout << "Multiplicity (1,17) after adding 1000: " << getCompactMultiplicity(spillMatrix, 1, 17) << std::endl;
+    std::cout << "Row 1 distinct neighbors: " << countCompactRowNonZeroCells(spillMatrix, 1)
+              << ", edge instances: " << sumCompactRowMultiplicities(spillMatrix, 1) << std::endl;
+    std::cout << "Spilled cells: " << spillMatrix.spilledCells.size() << std::endl;
+    std::cout << "Spilled row survives Compact -> List -> Compact: "
+              << (convertAdjacencyListToCompactMatrix(convertCompactMatrixToAdjacencyList(spillMatrix).adjacencyData, 20).spilledCells ==
+                  spillMatrix.spilledCells ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test that every representation of one graph hashes to the same fingerprint
+ */
+void testGraphFingerprints() {
+    std::cout << "\n=== Testing Graph Fingerprints ===" << std::endl;
+    
+    AdjacencyMatrix matrixFromFile = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList listFromMatrix = convertMatrixToAdjacencyList(matrixFromFile.matrixData, matrixFromFile.numberOfVertices);
+    ExtendedAdjacencyList extendedFromList = convertAdjacencyListToExtended(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    AdjacencyMap mapFromExtended = convertExtendedListToMap(extendedFromList.outgoingEdgeIndices, extendedFromList.incomingEdgeIndices,
+                                                            extendedFromList.edgeInstances, extendedFromList.numberOfVertices,
+                                                            extendedFromList.numberOfEdges);
+    AdjacencyMatrix matrixFromMap = convertAdjacencyMapToMatrix(mapFromExtended.outgoingConnections, mapFromExtended.numberOfVertices);
+    
+    GraphFingerprint matrixFingerprint = computeAdjacencyMatrixFingerprint(matrixFromFile);
+    std::cout << "Matrix fingerprint: " << formatGraphFingerprint(matrixFingerprint) << std::endl;
+    std::cout << "List matches: " << (computeAdjacencyListFingerprint(listFromMatrix) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Extended list matches: " << (computeExtendedAdjacencyListFingerprint(extendedFromList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Map matches: " << (computeAdjacencyMapFingerprint(mapFromExtended) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Matrix -> List -> Extended -> Map -> Matrix matches: "
+              << (computeAdjacencyMatrixFingerprint(matrixFromMap) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Compact matrix matches: "
+              << (computeCompactMultiplicityMatrixFingerprint(convertMatrixToCompactMatrix(matrixFromFile.matrixData, matrixFromFile.numberOfVertices)) == matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    // Row order must not matter, an extra edge instance must
+    AdjacencyList reorderedList = listFromMatrix;
+    for (std::vector<int>& neighbors : reorderedList.adjacencyData) {
+        std::reverse(neighbors.begin(), neighbors.end());
+    }
+    std::cout << "Reordered rows match: " << (computeAdjacencyListFingerprint(reorderedList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    reorderedList.adjacencyData[0].push_back(reorderedList.numberOfVertices - 1);
+    std::cout << "One extra edge differs: " << (computeAdjacencyListFingerprint(reorderedList) != matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    GraphFingerprint fileFingerprint = computeEdgeListFileFingerprint("input.txt");
+    std::cout << "Raw edge list fingerprint: " << formatGraphFingerprint(fileFingerprint)
+              << (fileFingerprint == matrixFingerprint ? " (same as matrix)" : " (differs: reader dropped edges)") << std::endl;
+}
+
+/**
+ * @brief Test typed edge and vertex property columns and that they follow edges through file, filter and CSR round trips
+ */
+void testEdgePropertyColumns() {
+    std::cout << "\n=== Testing Edge Property Columns ===" << std::endl;
+    const std::string PROPERTY_FILE = "edge_properties_temp.txt";
+    
+    ExtendedAdjacencyList extendedList = readExtendedAdjacencyListFromEdgeList("input.txt");
+    std::vector<double>& edgeWeights = addEdgePropertyColumn<double>(extendedList, "weight");
+    std::vector<long long>& edgeTimestamps = addEdgePropertyColumn<long long>(extendedList, "timestamp");
+    std::vector<std::string>& edgeLabels = addEdgePropertyColumn<std::string>(extendedList, "label");
+    for (int edgeIndex = 0; edgeIndex < extendedList.numberOfEdges; ++edgeIndex) {
+        edgeWeights[edgeIndex] = 0.5 * (edgeIndex + 1);
+        edgeTimestamps[edgeIndex] = 1000 + 10 * edgeIndex;
+        edgeLabels[edgeIndex] = extendedList.edgeInstances[edgeIndex].first == extendedList.edgeInstances[edgeIndex].second ? "loop" : "link";
+    }
+    std::vector<std::string>& vertexNames = addVertexPropertyColumn<std::string>(extendedList, "name");
+    for (int vertexIndex = 0; vertexIndex < extendedList.numberOfVertices; ++vertexIndex) {
+        vertexNames[vertexIndex] = "v" + std::to_string(vertexIndex);
+    }
+    displayPropertyColumns(extendedList.edgeProperties, "edge");
+    displayPropertyColumns(extendedList.vertexProperties, "vertex");
+    
+    std::vector<double> weightedOutDegrees = computeWeightedOutDegrees(extendedList, "weight");
+    std::cout << "Weighted out-degrees:";
+    for (double weightedDegree : weightedOutDegrees) {
+        std::cout << " " << weightedDegree;
+    }
+    std::cout << std::endl;
+    
+    writeExtendedAdjacencyListWithEdgeProperties(extendedList, PROPERTY_FILE);
+    ExtendedAdjacencyList listFromFile = readExtendedAdjacencyListWithEdgeProperties(PROPERTY_FILE);
+    std::remove(PROPERTY_FILE.c_str());
+    std::cout << "Property file round trip matches: "
+              << (listFromFile.edgeInstances == extendedList.edgeInstances &&
+                  arePropertyColumnsEqual(listFromFile.edgeProperties, extendedList.edgeProperties) ? "yes" : "no") << std::endl;
+    
+    PropertyColumnSet csrEdgeProperties;
+    CompressedSparseRow csrGraph = convertExtendedAdjacencyListToCompressedSparseRow(extendedList, csrEdgeProperties);
+    ExtendedAdjacencyList listFromCsr = convertCompressedSparseRowToExtendedAdjacencyList(csrGraph, csrEdgeProperties);
+    std::cout << "Weighted out-degrees survive Extended -> CSR -> Extended: "
+              << (computeWeightedOutDegrees(listFromCsr, "weight") == weightedOutDegrees ? "yes" : "no") << std::endl;
+    
+    // Keep only the later half of the edges by timestamp; their properties must come along
+    long long timestampThreshold = 1000 + 10 * (extendedList.numberOfEdges / 2);
+    ExtendedAdjacencyList recentEdges = filterExtendedAdjacencyListEdges(extendedList, [&](int edgeIndex) {
+        return edgeTimestamps[edgeIndex] >= timestampThreshold;
+    });
+    const std::vector<long long>* recentTimestamps = findPropertyColumn<long long>(recentEdges.edgeProperties, "timestamp");
+    bool allRecent = recentTimestamps != nullptr;
+    for (int edgeIndex = 0; allRecent && edgeIndex < recentEdges.numberOfEdges; ++edgeIndex) {
+        allRecent = (*recentTimestamps)[edgeIndex] >= timestampThreshold;
+    }
+    std::cout << "Edges with timestamp >= " << timestampThreshold << ": " << recentEdges.numberOfEdges
+              << " of " << extendedList.numberOfEdges << ", properties follow the edges: " << (allRecent ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test induced-subgraph and edge-filter extraction from CSR and adjacency list using matrix_input.txt
+ */
+void testSubgraphExtraction() {
+    std::cout << "\n=== Testing Subgraph Extraction ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    AdjacencyList adjacencyList = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    
+    // Induced subgraph on the even vertices
+    std::vector<int> selectedVertices;
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; vertexIndex += 2) {
+        selectedVertices.push_back(vertexIndex);
+    }
+    SubgraphVertexMap vertexMap = buildSubgraphVertexMap(selectedVertices, csrGraph.numberOfVertices);
+    CompressedSparseRow inducedCsr = extractInducedSubgraphFromCompressedSparseRow(csrGraph, vertexMap);
+    AdjacencyList inducedList = extractInducedSubgraphFromAdjacencyList(adjacencyList, vertexMap);
+    std::cout << "Subgraph vertex -> original vertex:";
+    for (int newVertex = 0; newVertex < static_cast<int>(vertexMap.originalIdOfVertex.size()); ++newVertex) {
+        std::cout << " " << newVertex << "->" << vertexMap.originalIdOfVertex[newVertex];
+    }
+    std::cout << std::endl;
+    displayCompressedSparseRow(inducedCsr);
+    
+    bool representationsAgree = inducedList.numberOfVertices == inducedCsr.numberOfVertices;
+    for (int newVertex = 0; representationsAgree && newVertex < inducedCsr.numberOfVertices; ++newVertex) {
+        std::vector<int> csrRow(inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex],
+                                inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex + 1]);
+        representationsAgree = csrRow == inducedList.adjacencyData[newVertex];
+    }
+    std::cout << "CSR and adjacency list extraction agree: " << (representationsAgree ? "yes" : "no") << std::endl;
+    
+    // Edge filter keeping only edges that point to a higher vertex id
+    auto pointsUpward = [](int sourceVertex, int targetVertex) { return sourceVertex < targetVertex; };
+    CompressedSparseRow upwardCsr = filterCompressedSparseRowEdges(csrGraph, pointsUpward);
+    AdjacencyList upwardList = filterAdjacencyListEdges(adjacencyList, pointsUpward);
+    int upwardListEdges = 0;
+    for (const std::vector<int>& neighbors : upwardList.adjacencyData) {
+        upwardListEdges += static_cast<int>(neighbors.size());
+    }
+    std::cout << "Upward edges kept: " << upwardCsr.numberOfEdges << " of " << csrGraph.numberOfEdges
+              << " (adjacency list: " << upwardListEdges << ")" << std::endl;
+}
+
+/**
+ * @brief Test pull-based PageRank, personalized PageRank and Katz centrality using input.txt
+ */
+void testLinkAnalysis() {
+    std::cout << "\n=== Testing Link Analysis ===" << std::endl;
+    
+    ExtendedAdjacencyList extendedList = readExtendedAdjacencyListFromEdgeList("input.txt");
+    BlockedCompressedSparseColumn pullGraph = buildBlockedCompressedSparseColumn(extendedList);
+    
+    LinkAnalysisResult pageRank = computePageRank(pullGraph);
+    displayLinkAnalysisResult(pageRank, "PageRank");
+    double scoreTotal = 0.0;
+    for (double vertexScore : pageRank.vertexScores) {
+        scoreTotal += vertexScore;
+    }
+    std::cout << "PageRank sums to 1: " << (std::fabs(scoreTotal - 1.0) < 1e-9 ? "yes" : "no") << std::endl;
+    
+    // Splitting sources into blocks of two vertices must not change the result
+    LinkAnalysisResult blockedPageRank = computePageRank(buildBlockedCompressedSparseColumn(extendedList, 2));
+    double largestDifference = 0.0;
+    for (int vertexIndex = 0; vertexIndex < static_cast<int>(pageRank.vertexScores.size()); ++vertexIndex) {
+        largestDifference = std::max(largestDifference, std::fabs(pageRank.vertexScores[vertexIndex] - blockedPageRank.vertexScores[vertexIndex]));
+    }
+    std::cout << "Blocks of 2 sources give the same PageRank: " << (largestDifference < 1e-12 ? "yes" : "no") << std::endl;
+    
+    displayLinkAnalysisResult(computePersonalizedPageRank(pullGraph, {0}), "Personalized PageRank from vertex 0");
+    displayLinkAnalysisResult(computeKatzCentrality(pullGraph, 0.1), "Katz centrality (alpha 0.1)");
+}
+
+/**
+ * @brief Test partitioned shard storage and breadth-first search over one worker process per shard
+ */
+void testPartitionedStorage() {
+    std::cout << "\n=== Testing Partitioned Storage ===" << std::endl;
+    
+    // A ring of 20000 vertices with short chords plus a few random long edges, so neighbors cluster
+    const int GENERATED_VERTEX_COUNT = 20000;
+    const std::string GENERATED_GRAPH_FILE = "partition_generated.txt";
+    std::vector<std::pair<int, int>> generatedEdges;
+    std::mt19937 randomGenerator(73);
+    for (int vertexIndex = 0; vertexIndex < GENERATED_VERTEX_COUNT; ++vertexIndex) {
+        for (int chordLength = 1; chordLength <= 3; ++chordLength) {
+            generatedEdges.push_back({vertexIndex, (vertexIndex + chordLength) % GENERATED_VERTEX_COUNT});
+        }
+        if (vertexIndex % 10 == 0) {
+            generatedEdges.push_back({vertexIndex, static_cast<int>(randomGenerator() % GENERATED_VERTEX_COUNT)});
+        }
+    }
+    std::ofstream generatedFile(GENERATED_GRAPH_FILE);
+    generatedFile << GENERATED_VERTEX_COUNT << " " << generatedEdges.size() << "\n";
+    for (const std::pair<int, int>& generatedEdge : generatedEdges) {
+        generatedFile << generatedEdge.first << " " << generatedEdge.second << "\n";
+    }
+    generatedFile.close();
+    
+    std::vector<std::string> inputFiles = {"input.txt", GENERATED_GRAPH_FILE};
+    std::vector<int> partitionCounts = {2, 4};
+    for (int fileIndex = 0; fileIndex < static_cast<int>(inputFiles.size()); ++fileIndex) {
+        AdjacencyList adjacencyList = readAdjacencyListFromEdgeList(inputFiles[fileIndex]);
+        std::vector<int> referenceDistances = computeBreadthFirstDistances(adjacencyList, 0);
+        
+        for (PartitionStrategy strategy : {PartitionStrategy::Hash, PartitionStrategy::LabelPropagation}) {
+            PartitionConfig config;
+            config.partitionCount = partitionCounts[fileIndex];
+            config.strategy = strategy;
+            PartitionSummary partitionSummary = partitionEdgeListIntoShardFiles(inputFiles[fileIndex], "partition_demo", config);
+            
+            std::cout << inputFiles[fileIndex] << ", " << config.partitionCount << " shards, "
+                      << (strategy == PartitionStrategy::Hash ? "hash" : "label propagation") << ": cut "
+                      << partitionSummary.cutEdges << " of " << partitionSummary.totalEdges << " edges, shard sizes";
+            for (int shardVertexCount : partitionSummary.shardVertexCounts) {
+                std::cout << " " << shardVertexCount;
+            }
+            std::cout << std::endl;
+            
+            DistributedTraversalResult traversalResult = runDistributedBreadthFirstSearch(partitionSummary.shardFileNames, 0,
+                                                                                          adjacencyList.numberOfVertices);
+            std::cout << "  Distributed BFS from 0: " << traversalResult.levelCount << " levels, "
+                      << traversalResult.exchangedVertexCount << " ghost vertices exchanged, matches single process: "
+                      << (traversalResult.vertexDistances == referenceDistances ? "yes" : "no") << std::endl;
+            
+            for (const std::string& shardFileName : partitionSummary.shardFileNames) {
+                std::remove(shardFileName.c_str());
+            }
+        }
+    }
+    std::remove(GENERATED_GRAPH_FILE.c_str());
+}
+
+/**
+ * @brief Test all-pairs reachability by bit-row Warshall and by component condensation
+ */
+void testTransitiveClosure() {
+    std::cout << "\n=== Testing Transitive Closure ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    ReachabilityIndex warshallIndex = computeTransitiveClosureWarshall(csrGraph);
+    ReachabilityIndex condensedIndex = computeTransitiveClosureByCondensation(csrGraph);
+    displayReachabilityMatrix(condensedIndex);
+    std::cout << "Warshall and condensation agree: " << (areReachabilityIndexesEqual(warshallIndex, condensedIndex) ? "yes" : "no") << std::endl;
+    
+    // Generated graph: mostly forward edges with a few backward ones, so there are both cycles and long chains
+    const int GENERATED_VERTEX_COUNT = 20000;
+    std::vector<std::vector<int>> generatedTargets(GENERATED_VERTEX_COUNT);
+    unsigned int randomState = 75;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        for (int linkIndex = 0; linkIndex < 2; ++linkIndex) {
+            randomState = randomState * 1103515245u + 12345u;
+            int targetVertex = sourceVertex + 1 + static_cast<int>((randomState >> 8) % 64);
+            if (linkIndex == 1 && (randomState >> 20) % 50 == 0) {
+                targetVertex = sourceVertex - 1 - static_cast<int>((randomState >> 8) % 200);
+            }
+            if (targetVertex >= 0 && targetVertex < GENERATED_VERTEX_COUNT) {
+                generatedTargets[sourceVertex].push_back(targetVertex);
+            }
+        }
+    }
+    CompressedSparseRow generatedGraph;
+    generatedGraph.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedGraph.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& targetList : generatedTargets) {
+        generatedGraph.columnIndices.insert(generatedGraph.columnIndices.end(), targetList.begin(), targetList.end());
+        generatedGraph.rowOffsets.push_back(static_cast<int>(generatedGraph.columnIndices.size()));
+    }
+    generatedGraph.numberOfEdges = static_cast<int>(generatedGraph.columnIndices.size());
+    
+    auto startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex generatedIndex = computeReachabilityIndex(generatedGraph);
+    double condensationSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::vector<int> sampleSources;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; sourceVertex += 997) {
+        sampleSources.push_back(sourceVertex);
+    }
+    std::cout << "Generated graph: " << generatedGraph.numberOfVertices << " vertices, " << generatedGraph.numberOfEdges << " edges, "
+              << generatedIndex.numberOfComponents << " components, " << countReachablePairs(generatedIndex)
+              << " reachable pairs, closure in " << condensationSeconds << " s" << std::endl;
+    std::cout << "Sampled rows match BFS: " << (verifyReachabilityIndex(generatedGraph, generatedIndex, sampleSources) ? "yes" : "no") << std::endl;
+    std::cout << "Vertex 0 reaches vertex " << GENERATED_VERTEX_COUNT - 1 << ": "
+              << (canReach(generatedIndex, 0, GENERATED_VERTEX_COUNT - 1) ? "yes" : "no") << std::endl;
+    
+    // Warshall on the first 2000 vertices must agree with the condensation
+    SubgraphVertexMap prefixMap = buildSubgraphVertexMapFromPredicate(GENERATED_VERTEX_COUNT, [](int vertexIndex) { return vertexIndex < 2000; });
+    CompressedSparseRow prefixGraph = extractInducedSubgraphFromCompressedSparseRow(generatedGraph, prefixMap);
+    startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex prefixWarshall = computeTransitiveClosureWarshall(prefixGraph);
+    double warshallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    ReachabilityIndex prefixCondensed = computeTransitiveClosureByCondensation(prefixGraph);
+    std::cout << "First 2000 vertices: Warshall in " << warshallSeconds << " s, agrees with condensation: "
+              << (areReachabilityIndexesEqual(prefixWarshall, prefixCondensed) ? "yes" : "no") << std::endl;
+}
+
 /**
  * @brief Main program entry point
  * @return Program exit status
@@ -174,6 +646,17 @@ int main() {
     try {
         demonstrateGraphRepresentationConversions();
         testMatrixInputFormat();
+        testSparseMatrixReader();
+        testStreamingStatistics();
+        testExternalMemoryConversion();
+        testSummaryDisplay();
+        testCompactMultiplicityMatrix();
+        testGraphFingerprints();
+        testEdgePropertyColumns();
+        testSubgraphExtraction();
+        testLinkAnalysis();
+        testPartitionedStorage();
+        testTransitiveClosure();
         
         std::cout << "=== General Graph Representation Demo Completed Successfully ===" << std::endl;
         
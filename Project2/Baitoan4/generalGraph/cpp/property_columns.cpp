@@ -0,0 +1,223 @@
+#include <iostream>
+#include <vector>
+#include <map>
+#include <string>
+
+/**
+ * @brief Value type of a property column
+ */
+enum class PropertyColumnType {
+    Integer,
+    Real,
+    Label
+};
+
+/**
+ * @brief Named, typed property columns stored as one flat vector per column (structure of arrays)
+ * @details Row r of every column belongs to the same edge or vertex id r. A scan that needs only
+ *          one column touches only that column's memory.
+ */
+struct PropertyColumnSet {
+    int rowCount;
+    std::map<std::string, std::vector<long long>> integerColumns;
+    std::map<std::string, std::vector<double>> realColumns;
+    std::map<std::string, std::vector<std::string>> labelColumns;
+
+    /**
+     * @brief Default constructor
+     */
+    PropertyColumnSet() : rowCount(0) {}
+
+    /**
+     * @brief Constructor with row count
+     * @param initialRowCount Number of rows every column will have
+     */
+    PropertyColumnSet(int initialRowCount) : rowCount(initialRowCount) {}
+
+    /**
+     * @brief Number of columns of all types
+     * @return Column count
+     */
+    int columnCount() const {
+        return static_cast<int>(integerColumns.size() + realColumns.size() + labelColumns.size());
+    }
+};
+
+/**
+ * @brief Get the columns of one value type
+ * @param columnSet The column set
+ * @return Map from column name to column of that type
+ */
+template <typename ValueType>
+std::map<std::string, std::vector<ValueType>>& getPropertyColumnMap(PropertyColumnSet& columnSet);
+
+template <>
+std::map<std::string, std::vector<long long>>& getPropertyColumnMap<long long>(PropertyColumnSet& columnSet) {
+    return columnSet.integerColumns;
+}
+
+template <>
+std::map<std::string, std::vector<double>>& getPropertyColumnMap<double>(PropertyColumnSet& columnSet) {
+    return columnSet.realColumns;
+}
+
+template <>
+std::map<std::string, std::vector<std::string>>& getPropertyColumnMap<std::string>(PropertyColumnSet& columnSet) {
+    return columnSet.labelColumns;
+}
+
+/**
+ * @brief Get the columns of one value type (read-only)
+ * @param columnSet The column set
+ * @return Map from column name to column of that type
+ */
+template <typename ValueType>
+const std::map<std::string, std::vector<ValueType>>& getPropertyColumnMap(const PropertyColumnSet& columnSet);
+
+template <>
+const std::map<std::string, std::vector<long long>>& getPropertyColumnMap<long long>(const PropertyColumnSet& columnSet) {
+    return columnSet.integerColumns;
+}
+
+template <>
+const std::map<std::string, std::vector<double>>& getPropertyColumnMap<double>(const PropertyColumnSet& columnSet) {
+    return columnSet.realColumns;
+}
+
+template <>
+const std::map<std::string, std::vector<std::string>>& getPropertyColumnMap<std::string>(const PropertyColumnSet& columnSet) {
+    return columnSet.labelColumns;
+}
+
+/**
+ * @brief Add a column filled with a default value, or return the existing column of that name and type
+ * @param columnSet The column set
+ * @param columnName Name of the column
+ * @param defaultValue Value of every existing row
+ * @return Reference to the column
+ */
+template <typename ValueType>
+std::vector<ValueType>& addPropertyColumn(PropertyColumnSet& columnSet, const std::string& columnName,
+                                          const ValueType& defaultValue = ValueType()) {
+    auto& columnMap = getPropertyColumnMap<ValueType>(columnSet);
+    auto columnPosition = columnMap.find(columnName);
+    if (columnPosition == columnMap.end()) {
+        columnPosition = columnMap.emplace(columnName, std::vector<ValueType>(columnSet.rowCount, defaultValue)).first;
+    }
+    return columnPosition->second;
+}
+
+/**
+ * @brief Look up a column by name and type
+ * @param columnSet The column set
+ * @param columnName Name of the column
+ * @return Pointer to the column, or nullptr if there is no such column of that type
+ */
+template <typename ValueType>
+const std::vector<ValueType>* findPropertyColumn(const PropertyColumnSet& columnSet, const std::string& columnName) {
+    const auto& columnMap = getPropertyColumnMap<ValueType>(columnSet);
+    auto columnPosition = columnMap.find(columnName);
+    return columnPosition == columnMap.end() ? nullptr : &columnPosition->second;
+}
+
+/**
+ * @brief Remove a column of any type
+ * @param columnSet The column set
+ * @param columnName Name of the column
+ * @return True if a column was removed
+ */
+bool removePropertyColumn(PropertyColumnSet& columnSet, const std::string& columnName) {
+    return columnSet.integerColumns.erase(columnName) + columnSet.realColumns.erase(columnName) +
+           columnSet.labelColumns.erase(columnName) > 0;
+}
+
+/**
+ * @brief Grow or shrink every column to a row count; new rows get the type's default value
+ * @param columnSet The column set
+ * @param newRowCount Number of rows afterwards
+ */
+void resizePropertyRows(PropertyColumnSet& columnSet, int newRowCount) {
+    columnSet.rowCount = newRowCount;
+    for (auto& column : columnSet.integerColumns) {
+        column.second.resize(newRowCount, 0);
+    }
+    for (auto& column : columnSet.realColumns) {
+        column.second.resize(newRowCount, 0.0);
+    }
+    for (auto& column : columnSet.labelColumns) {
+        column.second.resize(newRowCount);
+    }
+}
+
+/**
+ * @brief Gather rows of one column through a row map
+ * @param sourceColumn Column to read from
+ * @param sourceRowOfRow sourceRowOfRow[r] is the row copied to row r, or -1 for a default value
+ * @return Gathered column
+ */
+template <typename ValueType>
+std::vector<ValueType> gatherPropertyColumn(const std::vector<ValueType>& sourceColumn, const std::vector<int>& sourceRowOfRow) {
+    std::vector<ValueType> gatheredColumn(sourceRowOfRow.size());
+    for (int rowIndex = 0; rowIndex < static_cast<int>(sourceRowOfRow.size()); ++rowIndex) {
+        if (sourceRowOfRow[rowIndex] >= 0) {
+            gatheredColumn[rowIndex] = sourceColumn[sourceRowOfRow[rowIndex]];
+        }
+    }
+    return gatheredColumn;
+}
+
+/**
+ * @brief Reorder, filter or duplicate the rows of every column at once
+ * @details Conversions that renumber edges call this with their old-id-of-new-id map so properties follow the edges
+ * @param columnSet Columns to read from
+ * @param sourceRowOfRow sourceRowOfRow[r] is the row copied to row r, or -1 for a default value
+ * @return Column set with sourceRowOfRow.size() rows and the same columns
+ */
+PropertyColumnSet gatherPropertyRows(const PropertyColumnSet& columnSet, const std::vector<int>& sourceRowOfRow) {
+    PropertyColumnSet gatheredSet(static_cast<int>(sourceRowOfRow.size()));
+    for (const auto& column : columnSet.integerColumns) {
+        gatheredSet.integerColumns[column.first] = gatherPropertyColumn(column.second, sourceRowOfRow);
+    }
+    for (const auto& column : columnSet.realColumns) {
+        gatheredSet.realColumns[column.first] = gatherPropertyColumn(column.second, sourceRowOfRow);
+    }
+    for (const auto& column : columnSet.labelColumns) {
+        gatheredSet.labelColumns[column.first] = gatherPropertyColumn(column.second, sourceRowOfRow);
+    }
+    return gatheredSet;
+}
+
+/**
+ * @brief Check that two column sets hold the same columns and values
+ * @param leftSet First column set
+ * @param rightSet Second column set
+ * @return True if both are equal
+ */
+bool arePropertyColumnsEqual(const PropertyColumnSet& leftSet, const PropertyColumnSet& rightSet) {
+    return leftSet.rowCount == rightSet.rowCount && leftSet.integerColumns == rightSet.integerColumns &&
+           leftSet.realColumns == rightSet.realColumns && leftSet.labelColumns == rightSet.labelColumns;
+}
+
+/**
+ * @brief Display every column as name, type and its first values
+ * @param columnSet The column set
+ * @param rowLabel Name of the row kind, e.g. "edge"
+ */
+void displayPropertyColumns(const PropertyColumnSet& columnSet, const std::string& rowLabel) {
+    std::cout << columnSet.columnCount() << " " << rowLabel << " property column(s) over " << columnSet.rowCount << " rows" << std::endl;
+    for (const auto& column : columnSet.integerColumns) {
+        std::cout << "  " << column.first << " (integer): ";
+        displayTruncatedRowEntries(columnSet.rowCount, " ", [&](int rowIndex) { std::cout << column.second[rowIndex]; });
+        std::cout << std::endl;
+    }
+    for (const auto& column : columnSet.realColumns) {
+        std::cout << "  " << column.first << " (real): ";
+        displayTruncatedRowEntries(columnSet.rowCount, " ", [&](int rowIndex) { std::cout << column.second[rowIndex]; });
+        std::cout << std::endl;
+    }
+    for (const auto& column : columnSet.labelColumns) {
+        std::cout << "  " << column.first << " (label): ";
+        displayTruncatedRowEntries(columnSet.rowCount, " ", [&](int rowIndex) { std::cout << column.second[rowIndex]; });
+        std::cout << std::endl;
+    }
+}
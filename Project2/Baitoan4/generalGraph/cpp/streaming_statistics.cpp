@@ -0,0 +1,277 @@
+#include <iostream>
+#include <vector>
+#include <fstream>
+#include <map>
+#include <cmath>
+#include <cstdint>
+#include <algorithm>
+
+/**
+ * @brief Largest vertex count for which duplicate pairs are counted exactly with a V x V bitset (8 MB)
+ */
+const int EXACT_PAIR_BITSET_VERTEX_LIMIT = 8192;
+
+/**
+ * @brief Mix a 64-bit key into a well-distributed hash (splitmix64 finalizer)
+ * @param key Value to hash
+ * @return 64-bit hash
+ */
+inline std::uint64_t mixEdgeHash(std::uint64_t key) {
+    key += 0x9E3779B97F4A7C15ULL;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+/**
+ * @brief Pack a directed vertex pair into one 64-bit key
+ * @param sourceVertex Source vertex
+ * @param targetVertex Target vertex
+ * @return Packed key
+ */
+inline std::uint64_t packVertexPair(int sourceVertex, int targetVertex) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(sourceVertex)) << 32) | static_cast<std::uint32_t>(targetVertex);
+}
+
+/**
+ * @brief HyperLogLog sketch estimating the number of distinct keys in fixed memory
+ */
+struct HyperLogLogSketch {
+    std::vector<std::uint8_t> registerValues;
+    int precisionBits;
+
+    /**
+     * @brief Constructor with precision
+     * @param bits Number of index bits, 2^bits one-byte registers (standard error about 1.04 / sqrt(2^bits))
+     */
+    HyperLogLogSketch(int bits = 14) : precisionBits(bits) {
+        registerValues.assign(static_cast<std::size_t>(1) << bits, 0);
+    }
+
+    /**
+     * @brief Add a hashed key to the sketch
+     * @param keyHash 64-bit hash of the key
+     */
+    void addHash(std::uint64_t keyHash) {
+        std::size_t registerIndex = static_cast<std::size_t>(keyHash >> (64 - precisionBits));
+        std::uint64_t remainingBits = (keyHash << precisionBits) | (static_cast<std::uint64_t>(1) << (precisionBits - 1));
+        std::uint8_t leadingRank = static_cast<std::uint8_t>(__builtin_clzll(remainingBits) + 1);
+        registerValues[registerIndex] = std::max(registerValues[registerIndex], leadingRank);
+    }
+
+    /**
+     * @brief Estimate number of distinct keys added so far
+     * @return Cardinality estimate, using linear counting for small cardinalities
+     */
+    double estimateDistinctCount() const {
+        double registerCount = static_cast<double>(registerValues.size());
+        double harmonicSum = 0.0;
+        int zeroRegisterCount = 0;
+        for (std::uint8_t registerValue : registerValues) {
+            harmonicSum += std::ldexp(1.0, -registerValue);
+            if (registerValue == 0) {
+                zeroRegisterCount++;
+            }
+        }
+        double alphaConstant = 0.7213 / (1.0 + 1.079 / registerCount);
+        double rawEstimate = alphaConstant * registerCount * registerCount / harmonicSum;
+        if (rawEstimate <= 2.5 * registerCount && zeroRegisterCount > 0) {
+            return registerCount * std::log(registerCount / zeroRegisterCount);
+        }
+        return rawEstimate;
+    }
+};
+
+/**
+ * @brief Count-min sketch estimating per-key frequencies in fixed memory (never underestimates)
+ */
+struct CountMinSketch {
+    std::vector<std::uint32_t> counterTable;
+    int tableWidth;
+    int tableDepth;
+
+    /**
+     * @brief Constructor with table shape
+     * @param width Counters per row (power of two)
+     * @param depth Number of independent rows
+     */
+    CountMinSketch(int width = 1 << 16, int depth = 4) : tableWidth(width), tableDepth(depth) {
+        counterTable.assign(static_cast<std::size_t>(width) * depth, 0);
+    }
+
+    /**
+     * @brief Add one occurrence of a key and return its new frequency estimate
+     * @param keyHash 64-bit hash of the key
+     * @return Estimated frequency after the update
+     */
+    std::uint32_t addAndEstimate(std::uint64_t keyHash) {
+        std::uint32_t minimumCount = UINT32_MAX;
+        for (int rowIndex = 0; rowIndex < tableDepth; ++rowIndex) {
+            std::uint64_t rowHash = mixEdgeHash(keyHash + static_cast<std::uint64_t>(rowIndex) * 0x632BE59BD9B4E019ULL);
+            std::uint32_t& counter = counterTable[static_cast<std::size_t>(rowIndex) * tableWidth + (rowHash & (tableWidth - 1))];
+            counter++;
+            minimumCount = std::min(minimumCount, counter);
+        }
+        return minimumCount;
+    }
+};
+
+/**
+ * @brief Structure to hold statistics gathered in one pass over an edge list
+ */
+struct StreamingGraphStatistics {
+    std::vector<int> outDegrees;
+    std::vector<int> inDegrees;
+    std::map<int, int> degreeHistogram;
+    int numberOfVertices;
+    long long numberOfEdges;
+    long long selfLoopCount;
+    long long invalidEdgeCount;
+    long long parallelEdgeCount;
+    long long isolatedVertexCount;
+    long long maximumPairMultiplicity;
+    std::pair<int, int> mostRepeatedPair;
+    double density;
+    bool usesApproximateCounting;
+
+    /**
+     * @brief Default constructor
+     */
+    StreamingGraphStatistics() : numberOfVertices(0), numberOfEdges(0), selfLoopCount(0), invalidEdgeCount(0),
+                                 parallelEdgeCount(0), isolatedVertexCount(0), maximumPairMultiplicity(0),
+                                 mostRepeatedPair({-1, -1}), density(0.0), usesApproximateCounting(false) {}
+};
+
+/**
+ * @brief Compute graph statistics in one pass over an edge list file without building a representation
+ * @details Degrees use O(V) memory. Duplicate pairs are counted exactly with a V x V bitset for small graphs,
+ *          otherwise with a HyperLogLog distinct-pair estimate and a count-min sketch for the most repeated pair.
+ * @param fileName Name of input file containing edge list
+ * @param forceApproximate Use the sketches even when the exact bitset would fit
+ * @return StreamingGraphStatistics structure containing the results
+ */
+StreamingGraphStatistics computeStreamingGraphStatistics(const std::string& fileName, bool forceApproximate = false) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        exit(1);
+    }
+
+    StreamingGraphStatistics graphStatistics;
+    long long declaredEdgeCount;
+    inputFile >> graphStatistics.numberOfVertices >> declaredEdgeCount;
+    int numberOfVertices = graphStatistics.numberOfVertices;
+    graphStatistics.outDegrees.assign(numberOfVertices, 0);
+    graphStatistics.inDegrees.assign(numberOfVertices, 0);
+    graphStatistics.usesApproximateCounting = forceApproximate || numberOfVertices > EXACT_PAIR_BITSET_VERTEX_LIMIT;
+
+    std::vector<std::uint64_t> seenPairBits;
+    HyperLogLogSketch distinctPairSketch(graphStatistics.usesApproximateCounting ? 16 : 4);
+    CountMinSketch pairFrequencySketch(graphStatistics.usesApproximateCounting ? 1 << 18 : 1, graphStatistics.usesApproximateCounting ? 4 : 1);
+    std::map<std::uint64_t, long long> exactRepeatedPairs;
+    if (!graphStatistics.usesApproximateCounting) {
+        seenPairBits.assign((static_cast<std::size_t>(numberOfVertices) * numberOfVertices + 63) / 64, 0);
+    }
+    long long nonLoopEdgeCount = 0;
+
+    for (long long edgeIndex = 0; edgeIndex < declaredEdgeCount; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        if (!(inputFile >> sourceVertex >> targetVertex)) {
+            break;
+        }
+        if (sourceVertex < 0 || sourceVertex >= numberOfVertices || targetVertex < 0 || targetVertex >= numberOfVertices) {
+            graphStatistics.invalidEdgeCount++;
+            continue;
+        }
+
+        graphStatistics.numberOfEdges++;
+        graphStatistics.outDegrees[sourceVertex]++;
+        graphStatistics.inDegrees[targetVertex]++;
+        if (sourceVertex == targetVertex) {
+            graphStatistics.selfLoopCount++;
+            continue;
+        }
+        nonLoopEdgeCount++;
+
+        std::uint64_t pairKey = packVertexPair(sourceVertex, targetVertex);
+        if (graphStatistics.usesApproximateCounting) {
+            std::uint64_t pairHash = mixEdgeHash(pairKey);
+            distinctPairSketch.addHash(pairHash);
+            long long estimatedMultiplicity = pairFrequencySketch.addAndEstimate(pairHash);
+            if (estimatedMultiplicity > graphStatistics.maximumPairMultiplicity) {
+                graphStatistics.maximumPairMultiplicity = estimatedMultiplicity;
+                graphStatistics.mostRepeatedPair = {sourceVertex, targetVertex};
+            }
+        } else {
+            std::size_t bitIndex = static_cast<std::size_t>(sourceVertex) * numberOfVertices + targetVertex;
+            std::uint64_t bitMask = static_cast<std::uint64_t>(1) << (bitIndex & 63);
+            if (seenPairBits[bitIndex >> 6] & bitMask) {
+                // Only repeated pairs are kept, so this map stays as small as the duplicate set
+                graphStatistics.parallelEdgeCount++;
+                long long pairMultiplicity = ++exactRepeatedPairs[pairKey] + 1;
+                if (pairMultiplicity > graphStatistics.maximumPairMultiplicity) {
+                    graphStatistics.maximumPairMultiplicity = pairMultiplicity;
+                    graphStatistics.mostRepeatedPair = {sourceVertex, targetVertex};
+                }
+            } else {
+                seenPairBits[bitIndex >> 6] |= bitMask;
+                if (graphStatistics.maximumPairMultiplicity == 0) {
+                    graphStatistics.maximumPairMultiplicity = 1;
+                    graphStatistics.mostRepeatedPair = {sourceVertex, targetVertex};
+                }
+            }
+        }
+    }
+
+    long long distinctPairCount = nonLoopEdgeCount - graphStatistics.parallelEdgeCount;
+    if (graphStatistics.usesApproximateCounting) {
+        distinctPairCount = std::min(nonLoopEdgeCount, static_cast<long long>(std::llround(distinctPairSketch.estimateDistinctCount())));
+        graphStatistics.parallelEdgeCount = nonLoopEdgeCount - distinctPairCount;
+    }
+
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        int totalDegree = graphStatistics.outDegrees[vertexIndex] + graphStatistics.inDegrees[vertexIndex];
+        graphStatistics.degreeHistogram[totalDegree]++;
+        if (totalDegree == 0) {
+            graphStatistics.isolatedVertexCount++;
+        }
+    }
+
+    // Density of the underlying simple directed graph: distinct non-loop pairs over V(V-1)
+    if (numberOfVertices > 1) {
+        graphStatistics.density = static_cast<double>(distinctPairCount)
+                                / (static_cast<double>(numberOfVertices) * (numberOfVertices - 1));
+    }
+
+    inputFile.close();
+    return graphStatistics;
+}
+
+/**
+ * @brief Display streaming graph statistics to console
+ * @param graphStatistics The statistics to display
+ */
+void displayStreamingGraphStatistics(const StreamingGraphStatistics& graphStatistics) {
+    std::cout << "=== Streaming Graph Statistics ===" << std::endl;
+    std::cout << "Number of vertices: " << graphStatistics.numberOfVertices << std::endl;
+    std::cout << "Number of edges: " << graphStatistics.numberOfEdges << std::endl;
+    if (graphStatistics.invalidEdgeCount > 0) {
+        std::cout << "Invalid edges skipped: " << graphStatistics.invalidEdgeCount << std::endl;
+    }
+    std::cout << "Self-loops: " << graphStatistics.selfLoopCount << std::endl;
+    std::cout << "Parallel edges: " << graphStatistics.parallelEdgeCount
+              << (graphStatistics.usesApproximateCounting ? " (HyperLogLog estimate)" : " (exact)") << std::endl;
+    if (graphStatistics.maximumPairMultiplicity > 0) {
+        std::cout << "Most repeated pair: (" << graphStatistics.mostRepeatedPair.first << ","
+                  << graphStatistics.mostRepeatedPair.second << ") x" << graphStatistics.maximumPairMultiplicity
+                  << (graphStatistics.usesApproximateCounting ? " (count-min upper bound)" : "") << std::endl;
+    }
+    std::cout << "Isolated vertices: " << graphStatistics.isolatedVertexCount << std::endl;
+    std::cout << "Density: " << graphStatistics.density << std::endl;
+
+    std::cout << "\nDegree distribution (in + out):" << std::endl;
+    for (const auto& histogramEntry : graphStatistics.degreeHistogram) {
+        std::cout << "Degree " << histogramEntry.first << ": " << histogramEntry.second << " vertices" << std::endl;
+    }
+    std::cout << std::endl;
+}
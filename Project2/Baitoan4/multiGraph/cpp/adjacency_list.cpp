@@ -102,13 +102,47 @@ AdjacencyList convertMatrixToAdjacencyList(const std::vector<std::vector<int>>&
     return adjacencyList;
 }
 
+/**
+ * @brief Display adjacency list as edge count, degree histogram, top-degree vertices and sample rows
+ * @param adjacencyList The adjacency list to summarize
+ */
+void displayAdjacencyListSummary(const AdjacencyList& adjacencyList) {
+    std::vector<int> outDegrees(adjacencyList.numberOfVertices);
+    long long numberOfEdges = 0;
+    for (int vertexIndex = 0; vertexIndex < adjacencyList.numberOfVertices; ++vertexIndex) {
+        outDegrees[vertexIndex] = static_cast<int>(adjacencyList.adjacencyData[vertexIndex].size());
+        numberOfEdges += outDegrees[vertexIndex];
+    }
+    std::cout << "Number of edges: " << numberOfEdges << std::endl;
+    displayDegreeSummary(outDegrees, "Out-degree");
+
+    displaySampleRows(adjacencyList.numberOfVertices, [&](int vertexIndex) {
+        const std::vector<int>& neighbors = adjacencyList.adjacencyData[vertexIndex];
+        std::cout << "Vertex " << vertexIndex << ": ";
+        if (neighbors.empty()) {
+            std::cout << "(no outgoing edges)";
+        } else {
+            displayTruncatedRowEntries(outDegrees[vertexIndex], " ", [&](int entryIndex) {
+                std::cout << neighbors[entryIndex];
+            });
+        }
+        std::cout << std::endl;
+    });
+    std::cout << std::endl;
+}
+
 /**
  * @brief Display adjacency list to console
  * @param adjacencyList The adjacency list to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
  */
-void displayAdjacencyList(const AdjacencyList& adjacencyList) {
+void displayAdjacencyList(const AdjacencyList& adjacencyList, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
     std::cout << "=== Adjacency List (MultiGraph) ===" << std::endl;
     std::cout << "Number of vertices: " << adjacencyList.numberOfVertices << std::endl;
+    if (!shouldDisplayFullGraph(adjacencyList.numberOfVertices, displayMode)) {
+        displayAdjacencyListSummary(adjacencyList);
+        return;
+    }
     
     for (int vertexIndex = 0; vertexIndex < adjacencyList.numberOfVertices; ++vertexIndex) {
         std::cout << "Vertex " << vertexIndex << ": ";
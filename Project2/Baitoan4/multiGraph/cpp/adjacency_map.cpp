@@ -172,14 +172,50 @@ AdjacencyMap convertExtendedListToMap(const std::vector<std::vector<int>>& outgo
     return adjacencyMap;
 }
 
+/**
+ * @brief Display adjacency map as degree histogram, top-degree vertices and sample rows
+ * @param adjacencyMap The adjacency map to summarize
+ */
+void displayAdjacencyMapSummary(const AdjacencyMap& adjacencyMap) {
+    std::vector<int> outDegrees(adjacencyMap.numberOfVertices, 0);
+    for (const auto& vertexPair : adjacencyMap.outgoingConnections) {
+        if (vertexPair.first >= 0 && vertexPair.first < adjacencyMap.numberOfVertices) {
+            outDegrees[vertexPair.first] = static_cast<int>(vertexPair.second.size());
+        }
+    }
+    displayDegreeSummary(outDegrees, "Out-degree");
+
+    displaySampleRows(adjacencyMap.numberOfVertices, [&](int vertexIndex) {
+        std::cout << "Vertex " << vertexIndex << " -> ";
+        auto vertexIterator = adjacencyMap.outgoingConnections.find(vertexIndex);
+        if (vertexIterator == adjacencyMap.outgoingConnections.end() || vertexIterator->second.empty()) {
+            std::cout << "(no outgoing connections)";
+        } else {
+            const auto& connections = vertexIterator->second;
+            displayTruncatedRowEntries(static_cast<int>(connections.size()), ", ", [&](int entryIndex) {
+                const auto& connection = connections[entryIndex];
+                std::cout << connection.first << " [edge(" << connection.second.first
+                          << "," << connection.second.second << ")]";
+            });
+        }
+        std::cout << std::endl;
+    });
+    std::cout << std::endl;
+}
+
 /**
  * @brief Display adjacency map to console
  * @param adjacencyMap The adjacency map to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
  */
-void displayAdjacencyMap(const AdjacencyMap& adjacencyMap) {
+void displayAdjacencyMap(const AdjacencyMap& adjacencyMap, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
     std::cout << "=== Adjacency Map (MultiGraph) ===" << std::endl;
     std::cout << "Number of vertices: " << adjacencyMap.numberOfVertices << std::endl;
     std::cout << "Number of edges: " << adjacencyMap.numberOfEdges << std::endl;
+    if (!shouldDisplayFullGraph(adjacencyMap.numberOfVertices, displayMode)) {
+        displayAdjacencyMapSummary(adjacencyMap);
+        return;
+    }
     
     std::cout << "\nOutgoing connections:" << std::endl;
     for (const auto& vertexPair : adjacencyMap.outgoingConnections) {
@@ -0,0 +1,221 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+
+/**
+ * @brief Structure to represent compressed sparse row (CSR) layout for multigraph
+ * @details Neighbors of vertex v are columnIndices[rowOffsets[v] .. rowOffsets[v + 1])
+ */
+struct CompressedSparseRow {
+    std::vector<int> rowOffsets;
+    std::vector<int> columnIndices;
+    int numberOfVertices;
+    int numberOfEdges;
+
+    /**
+     * @brief Default constructor
+     */
+    CompressedSparseRow() : numberOfVertices(0), numberOfEdges(0) {}
+
+    /**
+     * @brief Constructor with vertex count
+     * @param vertexCount Number of vertices in the graph
+     */
+    CompressedSparseRow(int vertexCount) : numberOfVertices(vertexCount), numberOfEdges(0) {
+        rowOffsets.reserve(vertexCount + 1);
+        rowOffsets.push_back(0);
+    }
+};
+
+/**
+ * @brief Stream a matrix format file row by row, applying multigraph rules to every non-zero cell
+ * @details Only one cell is held in memory at a time, so the caller decides the storage cost
+ * @param inputFile Open input stream positioned right after the vertex count
+ * @param numberOfVertices Number of vertices in the graph
+ * @param visitEdge Called as visitEdge(source, target) once per parallel edge instance, in row-major order
+ * @param finishRow Called as finishRow(source) after each row has been scanned
+ */
+template <typename EdgeVisitor, typename RowVisitor>
+void scanMultiGraphMatrixRows(std::ifstream& inputFile, int numberOfVertices,
+                              EdgeVisitor visitEdge, RowVisitor finishRow) {
+    int selfLoopCount = 0;
+
+    for (int rowIndex = 0; rowIndex < numberOfVertices; ++rowIndex) {
+        for (int columnIndex = 0; columnIndex < numberOfVertices; ++columnIndex) {
+            int edgeValue;
+            inputFile >> edgeValue;
+            if (edgeValue <= 0) {
+                continue; // Zero cells are never stored
+            }
+
+            // Check for self-loops on diagonal
+            if (rowIndex == columnIndex) {
+                selfLoopCount += edgeValue;
+                std::cout << "Warning: Self-loop detected at vertex " << rowIndex
+                          << " with " << edgeValue
+                          << " edges - Removing as multigraphs do not allow self-loops" << std::endl;
+                continue;
+            }
+
+            // Multigraph keeps every parallel edge as its own instance
+            for (int edgeInstance = 0; edgeInstance < edgeValue; ++edgeInstance) {
+                visitEdge(rowIndex, columnIndex);
+            }
+        }
+        finishRow(rowIndex);
+    }
+
+    if (selfLoopCount > 0) {
+        std::cout << "Total self-loops removed: " << selfLoopCount << std::endl;
+    }
+}
+
+/**
+ * @brief Read matrix format file directly into CSR without building the dense V x V matrix
+ * @param fileName Name of input file containing matrix format
+ * @return CompressedSparseRow structure whose memory scales with E instead of V^2
+ */
+CompressedSparseRow readCompressedSparseRowFromMatrixFile(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return CompressedSparseRow();
+    }
+
+    int numberOfVertices;
+    inputFile >> numberOfVertices;
+
+    CompressedSparseRow csrGraph(numberOfVertices);
+    scanMultiGraphMatrixRows(inputFile, numberOfVertices,
+        [&](int, int targetVertex) {
+            csrGraph.columnIndices.push_back(targetVertex);
+        },
+        [&](int) {
+            csrGraph.rowOffsets.push_back(static_cast<int>(csrGraph.columnIndices.size()));
+        });
+
+    csrGraph.columnIndices.shrink_to_fit();
+    csrGraph.numberOfEdges = static_cast<int>(csrGraph.columnIndices.size());
+
+    inputFile.close();
+    return csrGraph;
+}
+
+/**
+ * @brief Read matrix format file directly into adjacency list without building the dense V x V matrix
+ * @param fileName Name of input file containing matrix format
+ * @return AdjacencyList structure whose memory scales with V + E
+ */
+AdjacencyList readAdjacencyListFromMatrixFile(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return AdjacencyList();
+    }
+
+    int numberOfVertices;
+    inputFile >> numberOfVertices;
+
+    AdjacencyList adjacencyList(numberOfVertices);
+    scanMultiGraphMatrixRows(inputFile, numberOfVertices,
+        [&](int sourceVertex, int targetVertex) {
+            adjacencyList.adjacencyData[sourceVertex].push_back(targetVertex);
+        },
+        [](int) {});
+
+    inputFile.close();
+    return adjacencyList;
+}
+
+/**
+ * @brief Read matrix format file directly into extended adjacency list without building the dense V x V matrix
+ * @param fileName Name of input file containing matrix format
+ * @return ExtendedAdjacencyList structure whose memory scales with V + E
+ */
+ExtendedAdjacencyList readExtendedAdjacencyListFromMatrixFile(const std::string& fileName) {
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return ExtendedAdjacencyList();
+    }
+
+    int numberOfVertices;
+    inputFile >> numberOfVertices;
+
+    ExtendedAdjacencyList extendedList(numberOfVertices);
+    int edgeCounter = 0;
+    scanMultiGraphMatrixRows(inputFile, numberOfVertices,
+        [&](int sourceVertex, int targetVertex) {
+            extendedList.edgeInstances.push_back({sourceVertex, targetVertex});
+            extendedList.outgoingEdgeIndices[sourceVertex].push_back(edgeCounter);
+            extendedList.incomingEdgeIndices[targetVertex].push_back(edgeCounter);
+            edgeCounter++;
+        },
+        [](int) {});
+
+    extendedList.numberOfEdges = edgeCounter;
+
+    inputFile.close();
+    return extendedList;
+}
+
+/**
+ * @brief Display CSR layout as degree histogram, top-degree vertices and sample rows
+ * @details Degrees come straight from rowOffsets, so nothing but the sampled rows touches columnIndices
+ * @param csrGraph The CSR structure to summarize
+ */
+void displayCompressedSparseRowSummary(const CompressedSparseRow& csrGraph) {
+    std::vector<int> outDegrees(csrGraph.numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; ++vertexIndex) {
+        outDegrees[vertexIndex] = csrGraph.rowOffsets[vertexIndex + 1] - csrGraph.rowOffsets[vertexIndex];
+    }
+    displayDegreeSummary(outDegrees, "Out-degree");
+
+    displaySampleRows(csrGraph.numberOfVertices, [&](int vertexIndex) {
+        int rowBegin = csrGraph.rowOffsets[vertexIndex];
+        std::cout << "Vertex " << vertexIndex << ": ";
+        if (outDegrees[vertexIndex] == 0) {
+            std::cout << "(no outgoing edges)";
+        } else {
+            displayTruncatedRowEntries(outDegrees[vertexIndex], " ", [&](int entryIndex) {
+                std::cout << csrGraph.columnIndices[rowBegin + entryIndex];
+            });
+        }
+        std::cout << std::endl;
+    });
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Display CSR layout to console
+ * @param csrGraph The CSR structure to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
+ */
+void displayCompressedSparseRow(const CompressedSparseRow& csrGraph, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
+    std::cout << "=== Compressed Sparse Row (MultiGraph) ===" << std::endl;
+    std::cout << "Number of vertices: " << csrGraph.numberOfVertices << std::endl;
+    std::cout << "Number of edges: " << csrGraph.numberOfEdges << std::endl;
+    if (!shouldDisplayFullGraph(csrGraph.numberOfVertices, displayMode)) {
+        displayCompressedSparseRowSummary(csrGraph);
+        return;
+    }
+
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; ++vertexIndex) {
+        std::cout << "Vertex " << vertexIndex << ": ";
+        int rowBegin = csrGraph.rowOffsets[vertexIndex];
+        int rowEnd = csrGraph.rowOffsets[vertexIndex + 1];
+        if (rowBegin == rowEnd) {
+            std::cout << "(no outgoing edges)";
+        } else {
+            for (int position = rowBegin; position < rowEnd; ++position) {
+                std::cout << csrGraph.columnIndices[position];
+                if (position < rowEnd - 1) {
+                    std::cout << " ";
+                }
+            }
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
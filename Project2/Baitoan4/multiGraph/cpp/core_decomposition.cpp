@@ -0,0 +1,301 @@
+#include <vector>
+#include <iostream>
+#include <atomic>
+#include <algorithm>
+
+/**
+ * @brief Core numbers of every vertex and the peeling order that produced them
+ * @details Vertex v is in the k-core (the largest subgraph where every degree is at least k)
+ *          exactly when coreNumbers[v] >= k
+ */
+struct CoreDecompositionResult {
+    std::vector<int> coreNumbers;
+    std::vector<int> peelingOrder;
+    int degeneracy;
+
+    /**
+     * @brief Default constructor
+     */
+    CoreDecompositionResult() : degeneracy(0) {}
+
+    /**
+     * @brief Constructor with vertex count
+     * @param vertexCount Number of vertices in the graph
+     */
+    CoreDecompositionResult(int vertexCount) : coreNumbers(vertexCount, 0), degeneracy(0) {
+        peelingOrder.reserve(vertexCount);
+    }
+};
+
+/**
+ * @brief Build the symmetric CSR of the undirected multigraph underlying a directed multigraph
+ * @details Every edge instance u->v is stored once in row u and once in row v, so row lengths are
+ *          degrees that count multiplicity
+ * @param adjacencyData Adjacency list data with one entry per edge instance
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompressedSparseRow with repeated entries for parallel edges
+ */
+CompressedSparseRow buildUndirectedMultigraphCompressedSparseRow(const std::vector<std::vector<int>>& adjacencyData, int numberOfVertices) {
+    CompressedSparseRow undirectedGraph(numberOfVertices);
+    undirectedGraph.rowOffsets.assign(numberOfVertices + 1, 0);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyData[sourceVertex]) {
+            undirectedGraph.rowOffsets[sourceVertex + 1]++;
+            undirectedGraph.rowOffsets[targetVertex + 1]++;
+        }
+    }
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        undirectedGraph.rowOffsets[vertexIndex + 1] += undirectedGraph.rowOffsets[vertexIndex];
+    }
+
+    undirectedGraph.columnIndices.resize(undirectedGraph.rowOffsets[numberOfVertices]);
+    std::vector<int> writeCursor(undirectedGraph.rowOffsets.begin(), undirectedGraph.rowOffsets.end() - 1);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyData[sourceVertex]) {
+            undirectedGraph.columnIndices[writeCursor[sourceVertex]++] = targetVertex;
+            undirectedGraph.columnIndices[writeCursor[targetVertex]++] = sourceVertex;
+        }
+    }
+    undirectedGraph.numberOfEdges = static_cast<int>(undirectedGraph.columnIndices.size()) / 2;
+    return undirectedGraph;
+}
+
+/**
+ * @brief Compute core numbers with the Batagelj-Zaversnik bucket queue in O(V + E)
+ * @details Vertices sit in an array sorted by current degree with bucketStart marking where each degree begins.
+ *          Removing the lowest-degree vertex moves each later neighbor one bucket down by a swap with the
+ *          first vertex of its bucket. A repeated neighbor entry (parallel edge) moves it once per entry.
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return CoreDecompositionResult with core numbers and the peeling order
+ */
+CoreDecompositionResult computeCoreDecomposition(const CompressedSparseRow& undirectedGraph) {
+    int numberOfVertices = undirectedGraph.numberOfVertices;
+    CoreDecompositionResult coreResult(numberOfVertices);
+    if (numberOfVertices == 0) {
+        return coreResult;
+    }
+
+    std::vector<int> currentDegrees(numberOfVertices);
+    int maximumDegree = 0;
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        currentDegrees[vertexIndex] = undirectedGraph.rowOffsets[vertexIndex + 1] - undirectedGraph.rowOffsets[vertexIndex];
+        maximumDegree = std::max(maximumDegree, currentDegrees[vertexIndex]);
+    }
+
+    // Counting sort of vertices by degree
+    std::vector<int> bucketStart(maximumDegree + 1, 0);
+    for (int degree : currentDegrees) {
+        bucketStart[degree]++;
+    }
+    int runningStart = 0;
+    for (int degree = 0; degree <= maximumDegree; ++degree) {
+        int bucketSize = bucketStart[degree];
+        bucketStart[degree] = runningStart;
+        runningStart += bucketSize;
+    }
+    std::vector<int> sortedVertices(numberOfVertices);
+    std::vector<int> sortedPosition(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        sortedPosition[vertexIndex] = bucketStart[currentDegrees[vertexIndex]]++;
+        sortedVertices[sortedPosition[vertexIndex]] = vertexIndex;
+    }
+    for (int degree = maximumDegree; degree > 0; --degree) {
+        bucketStart[degree] = bucketStart[degree - 1];
+    }
+    bucketStart[0] = 0;
+
+    for (int sortedIndex = 0; sortedIndex < numberOfVertices; ++sortedIndex) {
+        int peeledVertex = sortedVertices[sortedIndex];
+        coreResult.coreNumbers[peeledVertex] = currentDegrees[peeledVertex];
+        coreResult.peelingOrder.push_back(peeledVertex);
+        for (int position = undirectedGraph.rowOffsets[peeledVertex]; position < undirectedGraph.rowOffsets[peeledVertex + 1]; ++position) {
+            int neighbor = undirectedGraph.columnIndices[position];
+            if (currentDegrees[neighbor] <= currentDegrees[peeledVertex]) {
+                continue;
+            }
+            // Swap the neighbor with the first vertex of its bucket, then shrink the bucket from the front
+            int neighborDegree = currentDegrees[neighbor];
+            int firstPosition = bucketStart[neighborDegree];
+            int firstVertex = sortedVertices[firstPosition];
+            if (firstVertex != neighbor) {
+                std::swap(sortedVertices[firstPosition], sortedVertices[sortedPosition[neighbor]]);
+                sortedPosition[firstVertex] = sortedPosition[neighbor];
+                sortedPosition[neighbor] = firstPosition;
+            }
+            bucketStart[neighborDegree]++;
+            currentDegrees[neighbor]--;
+        }
+    }
+
+    coreResult.degeneracy = *std::max_element(coreResult.coreNumbers.begin(), coreResult.coreNumbers.end());
+    return coreResult;
+}
+
+/**
+ * @brief Smallest current degree among the remaining vertices, found by a parallel min-reduction
+ * @details Each worker block takes its local minimum and folds it into the shared result with one compare-exchange loop
+ * @param remainingVertices Vertices not yet peeled
+ * @param currentDegrees Current degree of every vertex
+ * @return Minimum degree, or 0 if no vertex remains
+ */
+int findMinimumRemainingDegree(const std::vector<int>& remainingVertices, const std::vector<std::atomic<int>>& currentDegrees) {
+    if (remainingVertices.empty()) {
+        return 0;
+    }
+    std::atomic<int> minimumDegree(currentDegrees[remainingVertices[0]].load(std::memory_order_relaxed));
+    runParallelForRange(static_cast<int>(remainingVertices.size()), [&](int rangeBegin, int rangeEnd) {
+        int localMinimum = minimumDegree.load(std::memory_order_relaxed);
+        for (int rangeIndex = rangeBegin; rangeIndex < rangeEnd; ++rangeIndex) {
+            localMinimum = std::min(localMinimum, currentDegrees[remainingVertices[rangeIndex]].load(std::memory_order_relaxed));
+        }
+        int sharedMinimum = minimumDegree.load(std::memory_order_relaxed);
+        while (localMinimum < sharedMinimum && !minimumDegree.compare_exchange_weak(sharedMinimum, localMinimum)) {
+        }
+    });
+    return minimumDegree.load();
+}
+
+/**
+ * @brief Compute core numbers by level-synchronous parallel peeling
+ * @details Level k repeatedly removes, in parallel, every remaining vertex whose degree is k. Degrees are atomic:
+ *          a decrement that takes a neighbor from k+1 to k adds it to the next frontier of the same level, and one
+ *          that would take it below k is undone. Remaining vertices are compacted between levels, so each level
+ *          scans only survivors. After each compaction the level jumps straight to the minimum degree of the
+ *          survivors, so empty levels are never scanned and the work does not grow with V times the degeneracy.
+ *          peelingOrder lists vertices level by level, in an order that depends on scheduling.
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return CoreDecompositionResult with the same core numbers as computeCoreDecomposition
+ */
+CoreDecompositionResult computeCoreDecompositionParallel(const CompressedSparseRow& undirectedGraph) {
+    int numberOfVertices = undirectedGraph.numberOfVertices;
+    CoreDecompositionResult coreResult(numberOfVertices);
+    std::vector<std::atomic<int>> currentDegrees(numberOfVertices);
+    std::vector<int> remainingVertices(numberOfVertices);
+    runParallelForRange(numberOfVertices, [&](int vertexBegin, int vertexEnd) {
+        for (int vertexIndex = vertexBegin; vertexIndex < vertexEnd; ++vertexIndex) {
+            currentDegrees[vertexIndex].store(undirectedGraph.rowOffsets[vertexIndex + 1] - undirectedGraph.rowOffsets[vertexIndex],
+                                              std::memory_order_relaxed);
+            remainingVertices[vertexIndex] = vertexIndex;
+        }
+    });
+
+    // Frontier slots are reserved a block at a time with one fetch_add per worker block
+    std::vector<int> currentFrontier(numberOfVertices);
+    std::vector<int> nextFrontier(numberOfVertices);
+    std::vector<char> isPeeled(numberOfVertices, 0);
+    int peeledCount = 0;
+
+    int coreLevel = findMinimumRemainingDegree(remainingVertices, currentDegrees);
+    while (peeledCount < numberOfVertices) {
+        std::atomic<int> frontierSize(0);
+        runParallelForRange(static_cast<int>(remainingVertices.size()), [&](int rangeBegin, int rangeEnd) {
+            std::vector<int> localFrontier;
+            for (int rangeIndex = rangeBegin; rangeIndex < rangeEnd; ++rangeIndex) {
+                if (currentDegrees[remainingVertices[rangeIndex]].load(std::memory_order_relaxed) <= coreLevel) {
+                    localFrontier.push_back(remainingVertices[rangeIndex]);
+                }
+            }
+            int writeStart = frontierSize.fetch_add(static_cast<int>(localFrontier.size()));
+            std::copy(localFrontier.begin(), localFrontier.end(), currentFrontier.begin() + writeStart);
+        });
+
+        int currentSize = frontierSize.load();
+        while (currentSize > 0) {
+            for (int frontierIndex = 0; frontierIndex < currentSize; ++frontierIndex) {
+                isPeeled[currentFrontier[frontierIndex]] = 1;
+                coreResult.coreNumbers[currentFrontier[frontierIndex]] = coreLevel;
+                coreResult.peelingOrder.push_back(currentFrontier[frontierIndex]);
+            }
+            peeledCount += currentSize;
+
+            std::atomic<int> nextSize(0);
+            runParallelForRange(currentSize, [&](int rangeBegin, int rangeEnd) {
+                std::vector<int> localFrontier;
+                for (int frontierIndex = rangeBegin; frontierIndex < rangeEnd; ++frontierIndex) {
+                    int peeledVertex = currentFrontier[frontierIndex];
+                    for (int position = undirectedGraph.rowOffsets[peeledVertex]; position < undirectedGraph.rowOffsets[peeledVertex + 1]; ++position) {
+                        int neighbor = undirectedGraph.columnIndices[position];
+                        if (isPeeled[neighbor] || currentDegrees[neighbor].load(std::memory_order_relaxed) <= coreLevel) {
+                            continue;
+                        }
+                        int previousDegree = currentDegrees[neighbor].fetch_sub(1, std::memory_order_relaxed);
+                        if (previousDegree == coreLevel + 1) {
+                            localFrontier.push_back(neighbor);
+                        } else if (previousDegree <= coreLevel) {
+                            currentDegrees[neighbor].fetch_add(1, std::memory_order_relaxed);
+                        }
+                    }
+                }
+                int writeStart = nextSize.fetch_add(static_cast<int>(localFrontier.size()));
+                std::copy(localFrontier.begin(), localFrontier.end(), nextFrontier.begin() + writeStart);
+            });
+            currentFrontier.swap(nextFrontier);
+            currentSize = nextSize.load();
+        }
+
+        remainingVertices.erase(std::remove_if(remainingVertices.begin(), remainingVertices.end(),
+                                               [&](int vertexIndex) { return isPeeled[vertexIndex] != 0; }),
+                                remainingVertices.end());
+        coreLevel = findMinimumRemainingDegree(remainingVertices, currentDegrees);
+    }
+
+    coreResult.degeneracy = numberOfVertices == 0 ? 0 : *std::max_element(coreResult.coreNumbers.begin(), coreResult.coreNumbers.end());
+    return coreResult;
+}
+
+/**
+ * @brief Compute core numbers of a multigraph given as adjacency list, counting parallel edges in degrees
+ * @param adjacencyList The adjacency list
+ * @return CoreDecompositionResult of the underlying undirected multigraph
+ */
+CoreDecompositionResult computeCoreDecompositionFromAdjacencyList(const AdjacencyList& adjacencyList) {
+    return computeCoreDecomposition(buildUndirectedMultigraphCompressedSparseRow(adjacencyList.adjacencyData, adjacencyList.numberOfVertices));
+}
+
+/**
+ * @brief Check the defining property of core numbers
+ * @details Every vertex with core number c must have at least c neighbor entries with core number >= c
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @param coreResult Core numbers to check
+ * @return True if every vertex has enough neighbors in its own core
+ */
+bool verifyCoreDecomposition(const CompressedSparseRow& undirectedGraph, const CoreDecompositionResult& coreResult) {
+    for (int vertexIndex = 0; vertexIndex < undirectedGraph.numberOfVertices; ++vertexIndex) {
+        int supportingNeighbors = 0;
+        for (int position = undirectedGraph.rowOffsets[vertexIndex]; position < undirectedGraph.rowOffsets[vertexIndex + 1]; ++position) {
+            if (coreResult.coreNumbers[undirectedGraph.columnIndices[position]] >= coreResult.coreNumbers[vertexIndex]) {
+                supportingNeighbors++;
+            }
+        }
+        if (supportingNeighbors < coreResult.coreNumbers[vertexIndex]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Display core numbers, degeneracy and the size of every k-core
+ * @param coreResult The core decomposition
+ */
+void displayCoreDecomposition(const CoreDecompositionResult& coreResult) {
+    std::cout << "Degeneracy: " << coreResult.degeneracy << std::endl;
+    std::cout << "Core numbers: ";
+    displayTruncatedRowEntries(static_cast<int>(coreResult.coreNumbers.size()), " ", [&](int vertexIndex) {
+        std::cout << vertexIndex << ":" << coreResult.coreNumbers[vertexIndex];
+    });
+    std::cout << std::endl;
+
+    std::vector<int> coreSizes(coreResult.degeneracy + 2, 0);
+    for (int coreNumber : coreResult.coreNumbers) {
+        coreSizes[coreNumber]++;
+    }
+    for (int coreLevel = coreResult.degeneracy - 1; coreLevel >= 0; --coreLevel) {
+        coreSizes[coreLevel] += coreSizes[coreLevel + 1];
+    }
+    std::cout << "k-core sizes:";
+    for (int coreLevel = 0; coreLevel <= coreResult.degeneracy; ++coreLevel) {
+        std::cout << " " << coreLevel << ":" << coreSizes[coreLevel];
+    }
+    std::cout << std::endl;
+}
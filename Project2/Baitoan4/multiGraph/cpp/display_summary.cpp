@@ -0,0 +1,158 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <functional>
+
+/**
+ * @brief How the display functions render a graph
+ */
+enum class GraphDisplayMode {
+    Automatic,
+    Summary,
+    Full
+};
+
+/**
+ * @brief Largest vertex count that Automatic mode still dumps in full
+ */
+const int FULL_DISPLAY_VERTEX_LIMIT = 64;
+
+/**
+ * @brief Number of highest-degree vertices listed by a summary
+ */
+const int SUMMARY_TOP_DEGREE_COUNT = 5;
+
+/**
+ * @brief Number of rows sampled from each end of the vertex range by a summary
+ */
+const int SUMMARY_SAMPLE_ROW_COUNT = 3;
+
+/**
+ * @brief Number of entries printed per sampled row before the rest is elided
+ */
+const int SUMMARY_ROW_ENTRY_LIMIT = 16;
+
+/**
+ * @brief Decide whether a display call should dump every row
+ * @param numberOfVertices Number of vertices in the graph
+ * @param displayMode Requested display mode
+ * @return True for a full dump, false for a summary
+ */
+bool shouldDisplayFullGraph(int numberOfVertices, GraphDisplayMode displayMode) {
+    if (displayMode == GraphDisplayMode::Automatic) {
+        return numberOfVertices <= FULL_DISPLAY_VERTEX_LIMIT;
+    }
+    return displayMode == GraphDisplayMode::Full;
+}
+
+/**
+ * @brief Display a power-of-two degree histogram, degree range and the top-degree vertices
+ * @details Runs in O(V log k) for k = SUMMARY_TOP_DEGREE_COUNT
+ * @param vertexDegrees Degree of every vertex
+ * @param degreeLabel Name of the degree kind, e.g. "Out-degree"
+ */
+void displayDegreeSummary(const std::vector<int>& vertexDegrees, const std::string& degreeLabel) {
+    int numberOfVertices = static_cast<int>(vertexDegrees.size());
+    if (numberOfVertices == 0) {
+        return;
+    }
+
+    // Bucket 0 holds degree 0, bucket b > 0 holds degrees in [2^(b-1), 2^b - 1]
+    std::vector<int> bucketCounts;
+    long long degreeTotal = 0;
+    int minimumDegree = vertexDegrees[0];
+    int maximumDegree = vertexDegrees[0];
+    for (int degree : vertexDegrees) {
+        int bucketIndex = 0;
+        while ((1LL << bucketIndex) <= degree) {
+            bucketIndex++;
+        }
+        if (bucketIndex >= static_cast<int>(bucketCounts.size())) {
+            bucketCounts.resize(bucketIndex + 1, 0);
+        }
+        bucketCounts[bucketIndex]++;
+        degreeTotal += degree;
+        minimumDegree = std::min(minimumDegree, degree);
+        maximumDegree = std::max(maximumDegree, degree);
+    }
+
+    std::cout << degreeLabel << " min/avg/max: " << minimumDegree << " / "
+              << static_cast<double>(degreeTotal) / numberOfVertices << " / " << maximumDegree << std::endl;
+    std::cout << degreeLabel << " histogram:" << std::endl;
+    for (int bucketIndex = 0; bucketIndex < static_cast<int>(bucketCounts.size()); ++bucketIndex) {
+        if (bucketCounts[bucketIndex] == 0) {
+            continue;
+        }
+        long long bucketLow = bucketIndex == 0 ? 0 : (1LL << (bucketIndex - 1));
+        long long bucketHigh = bucketIndex == 0 ? 0 : (1LL << bucketIndex) - 1;
+        std::cout << "  [" << bucketLow;
+        if (bucketHigh != bucketLow) {
+            std::cout << "-" << bucketHigh;
+        }
+        std::cout << "]: " << bucketCounts[bucketIndex] << std::endl;
+    }
+
+    int topCount = std::min(SUMMARY_TOP_DEGREE_COUNT, numberOfVertices);
+    std::vector<int> vertexOrder(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        vertexOrder[vertexIndex] = vertexIndex;
+    }
+    std::partial_sort(vertexOrder.begin(), vertexOrder.begin() + topCount, vertexOrder.end(),
+                      [&](int leftVertex, int rightVertex) {
+                          if (vertexDegrees[leftVertex] != vertexDegrees[rightVertex]) {
+                              return vertexDegrees[leftVertex] > vertexDegrees[rightVertex];
+                          }
+                          return leftVertex < rightVertex;
+                      });
+    std::cout << "Top " << topCount << " by " << degreeLabel << ": ";
+    for (int rankIndex = 0; rankIndex < topCount; ++rankIndex) {
+        std::cout << vertexOrder[rankIndex] << " (" << vertexDegrees[vertexOrder[rankIndex]] << ")";
+        if (rankIndex < topCount - 1) {
+            std::cout << ", ";
+        }
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Display the first and last SUMMARY_SAMPLE_ROW_COUNT rows of a graph
+ * @param numberOfVertices Number of vertices in the graph
+ * @param displayRow Called with a vertex index to print that vertex's row
+ */
+void displaySampleRows(int numberOfVertices, const std::function<void(int)>& displayRow) {
+    std::cout << "Sample rows:" << std::endl;
+    if (numberOfVertices <= 2 * SUMMARY_SAMPLE_ROW_COUNT) {
+        for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+            displayRow(vertexIndex);
+        }
+        return;
+    }
+    for (int vertexIndex = 0; vertexIndex < SUMMARY_SAMPLE_ROW_COUNT; ++vertexIndex) {
+        displayRow(vertexIndex);
+    }
+    std::cout << "... (" << numberOfVertices - 2 * SUMMARY_SAMPLE_ROW_COUNT << " rows omitted)" << std::endl;
+    for (int vertexIndex = numberOfVertices - SUMMARY_SAMPLE_ROW_COUNT; vertexIndex < numberOfVertices; ++vertexIndex) {
+        displayRow(vertexIndex);
+    }
+}
+
+/**
+ * @brief Print at most SUMMARY_ROW_ENTRY_LIMIT entries of a row, then the number of elided entries
+ * @param entryCount Number of entries in the row
+ * @param entrySeparator Text printed between entries
+ * @param displayEntry Called with an entry position to print that entry
+ */
+template <typename EntryPrinter>
+void displayTruncatedRowEntries(int entryCount, const std::string& entrySeparator, EntryPrinter displayEntry) {
+    int shownCount = std::min(entryCount, SUMMARY_ROW_ENTRY_LIMIT);
+    for (int entryIndex = 0; entryIndex < shownCount; ++entryIndex) {
+        if (entryIndex > 0) {
+            std::cout << entrySeparator;
+        }
+        displayEntry(entryIndex);
+    }
+    if (entryCount > shownCount) {
+        std::cout << entrySeparator << "... (+" << entryCount - shownCount << " more)";
+    }
+}
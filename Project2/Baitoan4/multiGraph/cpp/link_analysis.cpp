@@ -0,0 +1,305 @@
+#include <vector>
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+/**
+ * @brief Number of source vertices per block of the blocked CSC
+ * @details 2^20 sources keep one block of per-source contributions (8 MB of doubles) within a typical last-level cache.
+ *          Narrower blocks pay one extra read-modify-write of the target score per block a target appears in.
+ */
+const int SPMV_SOURCE_BLOCK_WIDTH = 1 << 20;
+
+/**
+ * @brief Number of items summed per partial of a parallel reduction
+ */
+const int SPMV_REDUCTION_CHUNK_SIZE = 1 << 14;
+
+/**
+ * @brief Incoming edges of the targets that have at least one source in one source block
+ * @details Sources of targetVertices[i] are sourceVertices[targetOffsets[i] .. targetOffsets[i + 1]),
+ *          targetVertices is increasing
+ */
+struct CompressedColumnBlock {
+    std::vector<int> targetVertices;
+    std::vector<int> targetOffsets;
+    std::vector<int> sourceVertices;
+};
+
+/**
+ * @brief Compressed sparse column (pull) layout split into source blocks for cache locality
+ * @details With blockWidth >= V there is a single block, which is a plain CSC without empty columns
+ */
+struct BlockedCompressedSparseColumn {
+    std::vector<CompressedColumnBlock> sourceBlocks;
+    std::vector<int> outDegrees;
+    int blockWidth;
+    int numberOfVertices;
+    int numberOfEdges;
+
+    /**
+     * @brief Default constructor
+     */
+    BlockedCompressedSparseColumn() : blockWidth(SPMV_SOURCE_BLOCK_WIDTH), numberOfVertices(0), numberOfEdges(0) {}
+};
+
+/**
+ * @brief Settings shared by the iterative link analysis algorithms
+ */
+struct LinkAnalysisOptions {
+    double dampingFactor;
+    double tolerance;
+    int maximumIterations;
+
+    /**
+     * @brief Default constructor with the usual PageRank settings
+     */
+    LinkAnalysisOptions() : dampingFactor(0.85), tolerance(1e-9), maximumIterations(200) {}
+};
+
+/**
+ * @brief Scores and convergence report of an iterative link analysis run
+ */
+struct LinkAnalysisResult {
+    std::vector<double> vertexScores;
+    int iterationCount;
+    double finalResidual;
+    bool converged;
+
+    /**
+     * @brief Default constructor
+     */
+    LinkAnalysisResult() : iterationCount(0), finalResidual(0.0), converged(false) {}
+};
+
+/**
+ * @brief Build the blocked CSC from the incoming edge indices of an extended adjacency list
+ * @details One pass over targets in increasing order appends each incoming edge to its source's block,
+ *          so every block comes out sorted by target in O(V + E) total
+ * @param extendedList The extended adjacency list
+ * @param blockWidth Number of source vertices per block
+ * @return BlockedCompressedSparseColumn structure for pull iteration
+ */
+BlockedCompressedSparseColumn buildBlockedCompressedSparseColumn(const ExtendedAdjacencyList& extendedList,
+                                                                 int blockWidth = SPMV_SOURCE_BLOCK_WIDTH) {
+    BlockedCompressedSparseColumn pullGraph;
+    pullGraph.blockWidth = std::max(1, blockWidth);
+    pullGraph.numberOfVertices = extendedList.numberOfVertices;
+    pullGraph.numberOfEdges = static_cast<int>(extendedList.edgeInstances.size());
+    pullGraph.sourceBlocks.resize((extendedList.numberOfVertices + pullGraph.blockWidth - 1) / pullGraph.blockWidth);
+    pullGraph.outDegrees.resize(extendedList.numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < extendedList.numberOfVertices; ++vertexIndex) {
+        pullGraph.outDegrees[vertexIndex] = static_cast<int>(extendedList.outgoingEdgeIndices[vertexIndex].size());
+    }
+
+    for (int targetVertex = 0; targetVertex < extendedList.numberOfVertices; ++targetVertex) {
+        for (int edgeIndex : extendedList.incomingEdgeIndices[targetVertex]) {
+            int sourceVertex = extendedList.edgeInstances[edgeIndex].first;
+            CompressedColumnBlock& sourceBlock = pullGraph.sourceBlocks[sourceVertex / pullGraph.blockWidth];
+            if (sourceBlock.targetVertices.empty() || sourceBlock.targetVertices.back() != targetVertex) {
+                sourceBlock.targetVertices.push_back(targetVertex);
+                sourceBlock.targetOffsets.push_back(static_cast<int>(sourceBlock.sourceVertices.size()));
+            }
+            sourceBlock.sourceVertices.push_back(sourceVertex);
+        }
+    }
+    for (CompressedColumnBlock& sourceBlock : pullGraph.sourceBlocks) {
+        sourceBlock.targetOffsets.push_back(static_cast<int>(sourceBlock.sourceVertices.size()));
+    }
+    return pullGraph;
+}
+
+/**
+ * @brief Sum values over [0, itemCount) in fixed-size chunks on worker threads
+ * @details Each chunk writes its own partial, so no locks or atomics are needed, and the chunking does not depend
+ *          on the thread count, so the result is bit-identical on every machine. A chunk is already
+ *          SPMV_REDUCTION_CHUNK_SIZE items, so chunks are spread over all workers without the per-item threshold.
+ * @param itemCount Number of items
+ * @param valueAt Called as valueAt(index) for every item
+ * @return Sum of all values
+ */
+template <typename ValueFunction>
+double sumInParallelChunks(int itemCount, ValueFunction valueAt) {
+    int chunkCount = (itemCount + SPMV_REDUCTION_CHUNK_SIZE - 1) / SPMV_REDUCTION_CHUNK_SIZE;
+    std::vector<double> chunkSums(chunkCount, 0.0);
+    runParallelForRange(chunkCount, [&](int chunkBegin, int chunkEnd) {
+        for (int chunkIndex = chunkBegin; chunkIndex < chunkEnd; ++chunkIndex) {
+            int itemEnd = std::min(itemCount, (chunkIndex + 1) * SPMV_REDUCTION_CHUNK_SIZE);
+            double chunkSum = 0.0;
+            for (int itemIndex = chunkIndex * SPMV_REDUCTION_CHUNK_SIZE; itemIndex < itemEnd; ++itemIndex) {
+                chunkSum += valueAt(itemIndex);
+            }
+            chunkSums[chunkIndex] = chunkSum;
+        }
+    }, 1);
+
+    double totalSum = 0.0;
+    for (double chunkSum : chunkSums) {
+        totalSum += chunkSum;
+    }
+    return totalSum;
+}
+
+/**
+ * @brief Iterate y = baseFactor * baseVector + scale * A^T (sourceWeights .* x) until the L1 change drops below tolerance
+ * @details Each worker owns a contiguous range of targets and walks the source blocks in order, so writes never
+ *          overlap and the reads of one block stay within SPMV_SOURCE_BLOCK_WIDTH contributions.
+ *          For PageRank, baseFactor also absorbs the score of dangling vertices, keeping the scores a distribution.
+ * @param pullGraph The blocked CSC
+ * @param sourceWeights Multiplier of every source's score before it is pulled (1/out-degree for PageRank)
+ * @param baseVector Constant term, also the starting vector
+ * @param scale Multiplier of the pulled sum
+ * @param redistributeDanglingScore True to hand the score of vertices without out-edges back through baseVector
+ * @param options Tolerance and iteration limit
+ * @return LinkAnalysisResult with the final scores
+ */
+LinkAnalysisResult iteratePullSpmv(const BlockedCompressedSparseColumn& pullGraph, const std::vector<double>& sourceWeights,
+                                   const std::vector<double>& baseVector, double scale, bool redistributeDanglingScore,
+                                   const LinkAnalysisOptions& options) {
+    int numberOfVertices = pullGraph.numberOfVertices;
+    LinkAnalysisResult analysisResult;
+    analysisResult.vertexScores = baseVector;
+    std::vector<double> sourceContributions(numberOfVertices, 0.0);
+    std::vector<double> nextScores(numberOfVertices, 0.0);
+
+    while (analysisResult.iterationCount < options.maximumIterations) {
+        const std::vector<double>& currentScores = analysisResult.vertexScores;
+        runParallelForRange(numberOfVertices, [&](int vertexBegin, int vertexEnd) {
+            for (int vertexIndex = vertexBegin; vertexIndex < vertexEnd; ++vertexIndex) {
+                sourceContributions[vertexIndex] = currentScores[vertexIndex] * sourceWeights[vertexIndex];
+            }
+        });
+
+        double baseFactor = 1.0;
+        if (redistributeDanglingScore) {
+            double danglingScore = sumInParallelChunks(numberOfVertices, [&](int vertexIndex) {
+                return pullGraph.outDegrees[vertexIndex] == 0 ? currentScores[vertexIndex] : 0.0;
+            });
+            baseFactor = (1.0 - scale) + scale * danglingScore;
+        }
+
+        runParallelForRange(numberOfVertices, [&](int targetBegin, int targetEnd) {
+            for (int targetVertex = targetBegin; targetVertex < targetEnd; ++targetVertex) {
+                nextScores[targetVertex] = 0.0;
+            }
+            for (const CompressedColumnBlock& sourceBlock : pullGraph.sourceBlocks) {
+                auto firstTarget = std::lower_bound(sourceBlock.targetVertices.begin(), sourceBlock.targetVertices.end(), targetBegin);
+                for (int columnIndex = static_cast<int>(firstTarget - sourceBlock.targetVertices.begin());
+                     columnIndex < static_cast<int>(sourceBlock.targetVertices.size()) && sourceBlock.targetVertices[columnIndex] < targetEnd;
+                     ++columnIndex) {
+                    double pulledSum = 0.0;
+                    for (int position = sourceBlock.targetOffsets[columnIndex]; position < sourceBlock.targetOffsets[columnIndex + 1]; ++position) {
+                        pulledSum += sourceContributions[sourceBlock.sourceVertices[position]];
+                    }
+                    nextScores[sourceBlock.targetVertices[columnIndex]] += pulledSum;
+                }
+            }
+            for (int targetVertex = targetBegin; targetVertex < targetEnd; ++targetVertex) {
+                nextScores[targetVertex] = baseFactor * baseVector[targetVertex] + scale * nextScores[targetVertex];
+            }
+        });
+
+        analysisResult.finalResidual = sumInParallelChunks(numberOfVertices, [&](int vertexIndex) {
+            return std::fabs(nextScores[vertexIndex] - currentScores[vertexIndex]);
+        });
+        analysisResult.vertexScores.swap(nextScores);
+        analysisResult.iterationCount++;
+        if (analysisResult.finalResidual < options.tolerance) {
+            analysisResult.converged = true;
+            break;
+        }
+    }
+    return analysisResult;
+}
+
+/**
+ * @brief Compute PageRank with a teleport distribution
+ * @param pullGraph The blocked CSC
+ * @param teleportVector Teleport probability of every vertex, summing to 1
+ * @param options Damping factor, tolerance and iteration limit
+ * @return LinkAnalysisResult whose scores sum to 1
+ */
+LinkAnalysisResult computePageRankWithTeleport(const BlockedCompressedSparseColumn& pullGraph, const std::vector<double>& teleportVector,
+                                               const LinkAnalysisOptions& options) {
+    std::vector<double> inverseOutDegrees(pullGraph.numberOfVertices, 0.0);
+    for (int vertexIndex = 0; vertexIndex < pullGraph.numberOfVertices; ++vertexIndex) {
+        if (pullGraph.outDegrees[vertexIndex] > 0) {
+            inverseOutDegrees[vertexIndex] = 1.0 / pullGraph.outDegrees[vertexIndex];
+        }
+    }
+    return iteratePullSpmv(pullGraph, inverseOutDegrees, teleportVector, options.dampingFactor, true, options);
+}
+
+/**
+ * @brief Compute PageRank with uniform teleport
+ * @param pullGraph The blocked CSC
+ * @param options Damping factor, tolerance and iteration limit
+ * @return LinkAnalysisResult whose scores sum to 1
+ */
+LinkAnalysisResult computePageRank(const BlockedCompressedSparseColumn& pullGraph, const LinkAnalysisOptions& options = LinkAnalysisOptions()) {
+    if (pullGraph.numberOfVertices == 0) {
+        return LinkAnalysisResult();
+    }
+    std::vector<double> uniformTeleport(pullGraph.numberOfVertices, 1.0 / pullGraph.numberOfVertices);
+    return computePageRankWithTeleport(pullGraph, uniformTeleport, options);
+}
+
+/**
+ * @brief Compute personalized PageRank, teleporting uniformly to a seed set
+ * @details Invalid and repeated seeds are ignored; with no valid seed the result is empty
+ * @param pullGraph The blocked CSC
+ * @param seedVertices Vertices the walk restarts from
+ * @param options Damping factor, tolerance and iteration limit
+ * @return LinkAnalysisResult whose scores sum to 1
+ */
+LinkAnalysisResult computePersonalizedPageRank(const BlockedCompressedSparseColumn& pullGraph, const std::vector<int>& seedVertices,
+                                               const LinkAnalysisOptions& options = LinkAnalysisOptions()) {
+    std::vector<double> seedTeleport(pullGraph.numberOfVertices, 0.0);
+    int seedCount = 0;
+    for (int seedVertex : seedVertices) {
+        if (seedVertex >= 0 && seedVertex < pullGraph.numberOfVertices && seedTeleport[seedVertex] == 0.0) {
+            seedTeleport[seedVertex] = 1.0;
+            seedCount++;
+        }
+    }
+    if (seedCount == 0) {
+        std::cerr << "Error: Personalized PageRank needs at least one valid seed vertex" << std::endl;
+        return LinkAnalysisResult();
+    }
+    for (double& teleportProbability : seedTeleport) {
+        teleportProbability /= seedCount;
+    }
+    return computePageRankWithTeleport(pullGraph, seedTeleport, options);
+}
+
+/**
+ * @brief Compute Katz centrality x = beta + alpha * A^T x
+ * @details Converges only for attenuation below 1 / (largest eigenvalue of A); otherwise the result reports
+ *          converged == false after maximumIterations. options.dampingFactor is not used.
+ * @param pullGraph The blocked CSC
+ * @param attenuationFactor alpha, weight of each additional hop
+ * @param baseScore beta, score every vertex starts with
+ * @param options Tolerance and iteration limit
+ * @return LinkAnalysisResult with unnormalized Katz scores
+ */
+LinkAnalysisResult computeKatzCentrality(const BlockedCompressedSparseColumn& pullGraph, double attenuationFactor, double baseScore = 1.0,
+                                         const LinkAnalysisOptions& options = LinkAnalysisOptions()) {
+    std::vector<double> unitWeights(pullGraph.numberOfVertices, 1.0);
+    std::vector<double> baseVector(pullGraph.numberOfVertices, baseScore);
+    return iteratePullSpmv(pullGraph, unitWeights, baseVector, attenuationFactor, false, options);
+}
+
+/**
+ * @brief Display scores with a convergence line
+ * @param analysisResult The link analysis result
+ * @param scoreLabel Name of the score, e.g. "PageRank"
+ */
+void displayLinkAnalysisResult(const LinkAnalysisResult& analysisResult, const std::string& scoreLabel) {
+    std::cout << scoreLabel << ": " << (analysisResult.converged ? "converged" : "not converged") << " after "
+              << analysisResult.iterationCount << " iterations (L1 change " << analysisResult.finalResidual << ")" << std::endl;
+    displayTruncatedRowEntries(static_cast<int>(analysisResult.vertexScores.size()), " ", [&](int vertexIndex) {
+        std::cout << vertexIndex << ":" << analysisResult.vertexScores[vertexIndex];
+    });
+    std::cout << std::endl;
+}
@@ -1,10 +1,22 @@
+#include "display_summary.cpp"
 #include "adjacency_matrix.cpp"
 #include "adjacency_list.cpp"
 #include "extended_adjacency_list.cpp"
 #include "adjacency_map.cpp"
+#include "compressed_sparse_row.cpp"
+#include "compact_multiplicity_matrix.cpp"
+#include "parallel_for.cpp"
+#include "graph_fingerprint.cpp"
+#include "subgraph_extraction.cpp"
+#include "link_analysis.cpp"
+#include "core_decomposition.cpp"
+#include "transitive_closure.cpp"
 #include <iostream>
+#include <vector>
 #include <fstream>
 #include <string>
+#include <algorithm>
+#include <chrono>
 
 /**
  * @brief Demonstrate all 12 conversion functions between graph representations for multigraph
@@ -163,6 +175,314 @@ void testMultiGraphMatrixInputFormat() {
     displayAdjacencyList(listFromMatrix);
 }
 
+/**
+ * @brief Test streaming matrix reader that skips zero cells instead of allocating V x V for multigraph
+ */
+void testMultiGraphSparseMatrixReader() {
+    std::cout << "\n=== Testing MultiGraph Sparse Matrix Reader ===" << std::endl;
+    
+    CompressedSparseRow csrFromFile = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into CSR:" << std::endl;
+    displayCompressedSparseRow(csrFromFile);
+    
+    AdjacencyList listFromFile = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into Adjacency List:" << std::endl;
+    displayAdjacencyList(listFromFile);
+}
+
+/**
+ * @brief Test summary display on a generated graph too large for a readable full dump
+ */
+void testMultiGraphSummaryDisplay() {
+    std::cout << "\n=== Testing MultiGraph Summary Display ===" << std::endl;
+    
+    // Every third vertex links to hub 0, the rest get a spread of 0-8 targets
+    const int GENERATED_VERTEX_COUNT = 2000;
+    std::vector<std::vector<int>> generatedData(GENERATED_VERTEX_COUNT);
+    for (int sourceVertex = 1; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        if (sourceVertex % 3 == 0) {
+            generatedData[sourceVertex].push_back(0);
+        }
+        for (int targetRank = 0; targetRank < sourceVertex % 9; ++targetRank) {
+            generatedData[sourceVertex].push_back((sourceVertex * 7 + targetRank * 13 + 1) % GENERATED_VERTEX_COUNT);
+        }
+    }
+    
+    AdjacencyMatrix generatedMatrix = convertAdjacencyListToMatrix(generatedData, GENERATED_VERTEX_COUNT);
+    AdjacencyList generatedList = convertMatrixToAdjacencyList(generatedMatrix.matrixData, GENERATED_VERTEX_COUNT);
+    ExtendedAdjacencyList generatedExtended = convertAdjacencyListToExtended(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    AdjacencyMap generatedMap = convertAdjacencyListToMap(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    CompressedSparseRow generatedCsr;
+    generatedCsr.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedCsr.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& neighbors : generatedList.adjacencyData) {
+        generatedCsr.columnIndices.insert(generatedCsr.columnIndices.end(), neighbors.begin(), neighbors.end());
+        generatedCsr.rowOffsets.push_back(static_cast<int>(generatedCsr.columnIndices.size()));
+    }
+    generatedCsr.numberOfEdges = static_cast<int>(generatedCsr.columnIndices.size());
+    
+    // Automatic mode switches to the summary above FULL_DISPLAY_VERTEX_LIMIT vertices
+    displayAdjacencyMatrix(generatedMatrix);
+    displayAdjacencyList(generatedList);
+    displayExtendedAdjacencyList(generatedExtended);
+    displayAdjacencyMap(generatedMap);
+    displayCompressedSparseRow(generatedCsr);
+    
+    std::cout << "Small input forced into summary mode:" << std::endl;
+    displayAdjacencyList(readAdjacencyListFromEdgeList("input.txt"), GraphDisplayMode::Summary);
+}
+
+/**
+ * @brief Test byte-per-cell multiplicity matrix, its spill table and conversions against the int matrix
+ */
+void testMultiGraphCompactMultiplicityMatrix() {
+    std::cout << "\n=== Testing MultiGraph Compact Multiplicity Matrix ===" << std::endl;
+    
+    CompactMultiplicityMatrix compactFromFile = readCompactMultiplicityMatrixFromEdgeList("input.txt");
+    displayCompactMultiplicityMatrix(compactFromFile);
+    
+    AdjacencyMatrix referenceMatrix = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList referenceList = convertMatrixToAdjacencyList(referenceMatrix.matrixData, referenceMatrix.numberOfVertices);
+    bool matrixMatches = convertCompactMatrixToMatrix(compactFromFile).matrixData == referenceMatrix.matrixData;
+    bool listMatches = convertCompactMatrixToAdjacencyList(compactFromFile).adjacencyData == referenceList.adjacencyData;
+    CompressedSparseRow csrFromCompact = convertCompactMatrixToCompressedSparseRow(compactFromFile);
+    bool csrMatches = csrFromCompact.numberOfEdges == compactFromFile.numberOfEdges;
+    for (int vertexIndex = 0; csrMatches && vertexIndex < csrFromCompact.numberOfVertices; ++vertexIndex) {
+        csrMatches = std::vector<int>(csrFromCompact.columnIndices.begin() + csrFromCompact.rowOffsets[vertexIndex],
+                                      csrFromCompact.columnIndices.begin() + csrFromCompact.rowOffsets[vertexIndex + 1]) ==
+                     referenceList.adjacencyData[vertexIndex];
+    }
+    CompactMultiplicityMatrix compactFromList = convertAdjacencyListToCompactMatrix(referenceList.adjacencyData, referenceList.numberOfVertices);
+    bool roundTripMatches = compactFromList.cellData == compactFromFile.cellData;
+    std::cout << "Compact -> Matrix matches int matrix: " << (matrixMatches ? "yes" : "no") << std::endl;
+    std::cout << "Compact -> List matches Matrix -> List: " << (listMatches ? "yes" : "no") << std::endl;
+    std::cout << "Compact -> CSR matches Matrix -> List: " << (csrMatches ? "yes" : "no") << std::endl;
+    std::cout << "List -> Compact matches file reader: " << (roundTripMatches ? "yes" : "no") << std::endl;
+    
+    // Push one cell past a byte so it moves into the spill table
+    CompactMultiplicityMatrix spillMatrix(20);
+    for (int edgeRepeat = 0; edgeRepeat < 300; ++edgeRepeat) {
+        incrementCompactMultiplicity(spillMatrix, 1, 2);
+    }
+    addCompactMultiplicity(spillMatrix, 1, 17, 1000);
+    incrementCompactMultiplicity(spillMatrix, 1, 5);
+    std::cout << "Multiplicity (1,2) after 300 increments: " << getCompactMultiplicity(spillMatrix, 1, 2) << std::endl;
+    std::cout << "Multiplicity (1,17) after adding 1000: " << getCompactMultiplicity(spillMatrix, 1, 17) << std::endl;
+    std::cout << "Row 1 distinct neighbors: " << countCompactRowNonZeroCells(spillMatrix, 1)
+              << ", edge instances: " << sumCompactRowMultiplicities(spillMatrix, 1) << std::endl;
+    std::cout << "Spilled cells: " << spillMatrix.spilledCells.size() << std::endl;
+    std::cout << "Spilled row survives Compact -> List -> Compact: "
+              << (convertAdjacencyListToCompactMatrix(convertCompactMatrixToAdjacencyList(spillMatrix).adjacencyData, 20).spilledCells ==
+                  spillMatrix.spilledCells ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test that every representation of one graph hashes to the same fingerprint
+ */
+void testMultiGraphFingerprints() {
+    std::cout << "\n=== Testing MultiGraph Fingerprints ===" << std::endl;
+    
+    AdjacencyMatrix matrixFromFile = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList listFromMatrix = convertMatrixToAdjacencyList(matrixFromFile.matrixData, matrixFromFile.numberOfVertices);
+    ExtendedAdjacencyList extendedFromList = convertAdjacencyListToExtended(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    AdjacencyMap mapFromExtended = convertExtendedListToMap(extendedFromList.outgoingEdgeIndices, extendedFromList.incomingEdgeIndices,
+                                                            extendedFromList.edgeInstances, extendedFromList.numberOfVertices,
+                                                            extendedFromList.numberOfEdges);
+    AdjacencyMatrix matrixFromMap = convertAdjacencyMapToMatrix(mapFromExtended.outgoingConnections, mapFromExtended.numberOfVertices);
+    
+    GraphFingerprint matrixFingerprint = computeAdjacencyMatrixFingerprint(matrixFromFile);
+    std::cout << "Matrix fingerprint: " << formatGraphFingerprint(matrixFingerprint) << std::endl;
+    std::cout << "List matches: " << (computeAdjacencyListFingerprint(listFromMatrix) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Extended list matches: " << (computeExtendedAdjacencyListFingerprint(extendedFromList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Map matches: " << (computeAdjacencyMapFingerprint(mapFromExtended) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Matrix -> List -> Extended -> Map -> Matrix matches: "
+              << (computeAdjacencyMatrixFingerprint(matrixFromMap) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Compact matrix matches: "
+              << (computeCompactMultiplicityMatrixFingerprint(convertMatrixToCompactMatrix(matrixFromFile.matrixData, matrixFromFile.numberOfVertices)) == matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    // Row order must not matter, an extra edge instance must
+    AdjacencyList reorderedList = listFromMatrix;
+    for (std::vector<int>& neighbors : reorderedList.adjacencyData) {
+        std::reverse(neighbors.begin(), neighbors.end());
+    }
+    std::cout << "Reordered rows match: " << (computeAdjacencyListFingerprint(reorderedList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    reorderedList.adjacencyData[0].push_back(reorderedList.numberOfVertices - 1);
+    std::cout << "One extra edge differs: " << (computeAdjacencyListFingerprint(reorderedList) != matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    GraphFingerprint fileFingerprint = computeEdgeListFileFingerprint("input.txt");
+    std::cout << "Raw edge list fingerprint: " << formatGraphFingerprint(fileFingerprint)
+              << (fileFingerprint == matrixFingerprint ? " (same as matrix)" : " (differs: reader dropped edges)") << std::endl;
+}
+
+/**
+ * @brief Test induced-subgraph and edge-filter extraction from CSR and adjacency list using matrix_input.txt
+ */
+void testMultiGraphSubgraphExtraction() {
+    std::cout << "\n=== Testing Subgraph Extraction ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    AdjacencyList adjacencyList = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    
+    // Induced subgraph on the even vertices
+    std::vector<int> selectedVertices;
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; vertexIndex += 2) {
+        selectedVertices.push_back(vertexIndex);
+    }
+    SubgraphVertexMap vertexMap = buildSubgraphVertexMap(selectedVertices, csrGraph.numberOfVertices);
+    CompressedSparseRow inducedCsr = extractInducedSubgraphFromCompressedSparseRow(csrGraph, vertexMap);
+    AdjacencyList inducedList = extractInducedSubgraphFromAdjacencyList(adjacencyList, vertexMap);
+    std::cout << "Subgraph vertex -> original vertex:";
+    for (int newVertex = 0; newVertex < static_cast<int>(vertexMap.originalIdOfVertex.size()); ++newVertex) {
+        std::cout << " " << newVertex << "->" << vertexMap.originalIdOfVertex[newVertex];
+    }
+    std::cout << std::endl;
+    displayCompressedSparseRow(inducedCsr);
+    
+    bool representationsAgree = inducedList.numberOfVertices == inducedCsr.numberOfVertices;
+    for (int newVertex = 0; representationsAgree && newVertex < inducedCsr.numberOfVertices; ++newVertex) {
+        std::vector<int> csrRow(inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex],
+                                inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex + 1]);
+        representationsAgree = csrRow == inducedList.adjacencyData[newVertex];
+    }
+    std::cout << "CSR and adjacency list extraction agree: " << (representationsAgree ? "yes" : "no") << std::endl;
+    
+    // Edge filter keeping only edges that point to a higher vertex id
+    auto pointsUpward = [](int sourceVertex, int targetVertex) { return sourceVertex < targetVertex; };
+    CompressedSparseRow upwardCsr = filterCompressedSparseRowEdges(csrGraph, pointsUpward);
+    AdjacencyList upwardList = filterAdjacencyListEdges(adjacencyList, pointsUpward);
+    int upwardListEdges = 0;
+    for (const std::vector<int>& neighbors : upwardList.adjacencyData) {
+        upwardListEdges += static_cast<int>(neighbors.size());
+    }
+    std::cout << "Upward edges kept: " << upwardCsr.numberOfEdges << " of " << csrGraph.numberOfEdges
+              << " (adjacency list: " << upwardListEdges << ")" << std::endl;
+}
+
+/**
+ * @brief Test pull-based PageRank, personalized PageRank and Katz centrality using input.txt
+ */
+void testMultiGraphLinkAnalysis() {
+    std::cout << "\n=== Testing Link Analysis ===" << std::endl;
+    
+    ExtendedAdjacencyList extendedList = readExtendedAdjacencyListFromEdgeList("input.txt");
+    BlockedCompressedSparseColumn pullGraph = buildBlockedCompressedSparseColumn(extendedList);
+    
+    LinkAnalysisResult pageRank = computePageRank(pullGraph);
+    displayLinkAnalysisResult(pageRank, "PageRank");
+    double scoreTotal = 0.0;
+    for (double vertexScore : pageRank.vertexScores) {
+        scoreTotal += vertexScore;
+    }
+    std::cout << "PageRank sums to 1: " << (std::fabs(scoreTotal - 1.0) < 1e-9 ? "yes" : "no") << std::endl;
+    
+    // Splitting sources into blocks of two vertices must not change the result
+    LinkAnalysisResult blockedPageRank = computePageRank(buildBlockedCompressedSparseColumn(extendedList, 2));
+    double largestDifference = 0.0;
+    for (int vertexIndex = 0; vertexIndex < static_cast<int>(pageRank.vertexScores.size()); ++vertexIndex) {
+        largestDifference = std::max(largestDifference, std::fabs(pageRank.vertexScores[vertexIndex] - blockedPageRank.vertexScores[vertexIndex]));
+    }
+    std::cout << "Blocks of 2 sources give the same PageRank: " << (largestDifference < 1e-12 ? "yes" : "no") << std::endl;
+    
+    displayLinkAnalysisResult(computePersonalizedPageRank(pullGraph, {0}), "Personalized PageRank from vertex 0");
+    displayLinkAnalysisResult(computeKatzCentrality(pullGraph, 0.1), "Katz centrality (alpha 0.1)");
+}
+
+/**
+ * @brief Test bucket-queue and parallel k-core decomposition using input.txt and a generated graph
+ */
+void testMultiGraphCoreDecomposition() {
+    std::cout << "\n=== Testing Core Decomposition ===" << std::endl;
+    
+    AdjacencyList adjacencyList = readAdjacencyListFromEdgeList("input.txt");
+    CompressedSparseRow undirectedGraph = buildUndirectedMultigraphCompressedSparseRow(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+    CoreDecompositionResult coreResult = computeCoreDecomposition(undirectedGraph);
+    displayCoreDecomposition(coreResult);
+    std::cout << "Core property holds: " << (verifyCoreDecomposition(undirectedGraph, coreResult) ? "yes" : "no") << std::endl;
+    std::cout << "Parallel peeling agrees: "
+              << (computeCoreDecompositionParallel(undirectedGraph).coreNumbers == coreResult.coreNumbers ? "yes" : "no") << std::endl;
+    
+    // Larger generated graph: every vertex links to a few pseudo-random targets, more for low ids
+    const int GENERATED_VERTEX_COUNT = 50000;
+    AdjacencyList generatedList(GENERATED_VERTEX_COUNT);
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        int linkCount = 2 + 200000 / (sourceVertex + 1000);
+        for (int linkIndex = 1; linkIndex <= linkCount; ++linkIndex) {
+            int targetVertex = static_cast<int>((sourceVertex * 7919LL + linkIndex * 104729LL) % GENERATED_VERTEX_COUNT);
+            if (targetVertex != sourceVertex) {
+                generatedList.adjacencyData[sourceVertex].push_back(targetVertex);
+            }
+        }
+    }
+    CompressedSparseRow generatedGraph = buildUndirectedMultigraphCompressedSparseRow(generatedList.adjacencyData, generatedList.numberOfVertices);
+    CoreDecompositionResult generatedCores = computeCoreDecomposition(generatedGraph);
+    std::cout << "Generated graph: " << generatedGraph.numberOfVertices << " vertices, " << generatedGraph.numberOfEdges
+              << " undirected edges, degeneracy " << generatedCores.degeneracy << ", core property holds: "
+              << (verifyCoreDecomposition(generatedGraph, generatedCores) ? "yes" : "no") << ", parallel peeling agrees: "
+              << (computeCoreDecompositionParallel(generatedGraph).coreNumbers == generatedCores.coreNumbers ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test all-pairs reachability by bit-row Warshall and by component condensation
+ */
+void testMultiGraphTransitiveClosure() {
+    std::cout << "\n=== Testing Transitive Closure ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    ReachabilityIndex warshallIndex = computeTransitiveClosureWarshall(csrGraph);
+    ReachabilityIndex condensedIndex = computeTransitiveClosureByCondensation(csrGraph);
+    displayReachabilityMatrix(condensedIndex);
+    std::cout << "Warshall and condensation agree: " << (areReachabilityIndexesEqual(warshallIndex, condensedIndex) ? "yes" : "no") << std::endl;
+    
+    // Generated graph: mostly forward edges with a few backward ones, so there are both cycles and long chains
+    const int GENERATED_VERTEX_COUNT = 20000;
+    std::vector<std::vector<int>> generatedTargets(GENERATED_VERTEX_COUNT);
+    unsigned int randomState = 75;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        for (int linkIndex = 0; linkIndex < 2; ++linkIndex) {
+            randomState = randomState * 1103515245u + 12345u;
+            int targetVertex = sourceVertex + 1 + static_cast<int>((randomState >> 8) % 64);
+            if (linkIndex == 1 && (randomState >> 20) % 50 == 0) {
+                targetVertex = sourceVertex - 1 - static_cast<int>((randomState >> 8) % 200);
+            }
+            if (targetVertex >= 0 && targetVertex < GENERATED_VERTEX_COUNT) {
+                generatedTargets[sourceVertex].push_back(targetVertex);
+            }
+        }
+    }
+    CompressedSparseRow generatedGraph;
+    generatedGraph.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedGraph.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& targetList : generatedTargets) {
+        generatedGraph.columnIndices.insert(generatedGraph.columnIndices.end(), targetList.begin(), targetList.end());
+        generatedGraph.rowOffsets.push_back(static_cast<int>(generatedGraph.columnIndices.size()));
+    }
+    generatedGraph.numberOfEdges = static_cast<int>(generatedGraph.columnIndices.size());
+    
+    auto startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex generatedIndex = computeReachabilityIndex(generatedGraph);
+    double condensationSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::vector<int> sampleSources;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; sourceVertex += 997) {
+        sampleSources.push_back(sourceVertex);
+    }
+    std::cout << "Generated graph: " << generatedGraph.numberOfVertices << " vertices, " << generatedGraph.numberOfEdges << " edges, "
+              << generatedIndex.numberOfComponents << " components, " << countReachablePairs(generatedIndex)
+              << " reachable pairs, closure in " << condensationSeconds << " s" << std::endl;
+    std::cout << "Sampled rows match BFS: " << (verifyReachabilityIndex(generatedGraph, generatedIndex, sampleSources) ? "yes" : "no") << std::endl;
+    std::cout << "Vertex 0 reaches vertex " << GENERATED_VERTEX_COUNT - 1 << ": "
+              << (canReach(generatedIndex, 0, GENERATED_VERTEX_COUNT - 1) ? "yes" : "no") << std::endl;
+    
+    // Warshall on the first 2000 vertices must agree with the condensation
+    SubgraphVertexMap prefixMap = buildSubgraphVertexMapFromPredicate(GENERATED_VERTEX_COUNT, [](int vertexIndex) { return vertexIndex < 2000; });
+    CompressedSparseRow prefixGraph = extractInducedSubgraphFromCompressedSparseRow(generatedGraph, prefixMap);
+    startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex prefixWarshall = computeTransitiveClosureWarshall(prefixGraph);
+    double warshallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    ReachabilityIndex prefixCondensed = computeTransitiveClosureByCondensation(prefixGraph);
+    std::cout << "First 2000 vertices: Warshall in " << warshallSeconds << " s, agrees with condensation: "
+              << (areReachabilityIndexesEqual(prefixWarshall, prefixCondensed) ? "yes" : "no") << std::endl;
+}
+
 /**
  * @brief Main program entry point
  * @return Program exit status
@@ -174,6 +494,14 @@ int main() {
     try {
         demonstrateMultiGraphRepresentationConversions();
         testMultiGraphMatrixInputFormat();
+        testMultiGraphSparseMatrixReader();
+        testMultiGraphSummaryDisplay();
+        testMultiGraphCompactMultiplicityMatrix();
+        testMultiGraphFingerprints();
+        testMultiGraphSubgraphExtraction();
+        testMultiGraphLinkAnalysis();
+        testMultiGraphCoreDecomposition();
+        testMultiGraphTransitiveClosure();
         
         std::cout << "=== MultiGraph Representation Demo Completed Successfully ===" << std::endl;
         
@@ -0,0 +1,409 @@
+#include <vector>
+#include <iostream>
+#include <algorithm>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Vertex count up to which computeReachabilityIndex runs Warshall on the vertex matrix directly
+ */
+const int WARSHALL_MAX_VERTEX_COUNT = 2048;
+
+/**
+ * @brief Square bit matrix stored as rows of 64-bit words
+ * @details Rows are padded to an even number of words so the SSE2 OR always works on whole 128-bit blocks
+ */
+struct BitPackedMatrix {
+    std::vector<std::uint64_t> bitWords;
+    int dimension;
+    int wordsPerRow;
+
+    /**
+     * @brief Default constructor
+     */
+    BitPackedMatrix() : dimension(0), wordsPerRow(0) {}
+
+    /**
+     * @brief Constructor with dimension, all bits clear
+     * @param matrixDimension Number of rows and columns
+     */
+    BitPackedMatrix(int matrixDimension) : dimension(matrixDimension), wordsPerRow(((matrixDimension + 127) / 128) * 2) {
+        bitWords.assign(static_cast<std::size_t>(dimension) * wordsPerRow, 0);
+    }
+
+    /**
+     * @brief Test one bit
+     * @param rowIndex Row
+     * @param columnIndex Column
+     * @return True if the bit is set
+     */
+    bool test(int rowIndex, int columnIndex) const {
+        return (bitWords[static_cast<std::size_t>(rowIndex) * wordsPerRow + (columnIndex >> 6)] >> (columnIndex & 63)) & 1ULL;
+    }
+
+    /**
+     * @brief Set one bit
+     * @param rowIndex Row
+     * @param columnIndex Column
+     */
+    void set(int rowIndex, int columnIndex) {
+        bitWords[static_cast<std::size_t>(rowIndex) * wordsPerRow + (columnIndex >> 6)] |= 1ULL << (columnIndex & 63);
+    }
+
+    /**
+     * @brief First word of a row
+     * @param rowIndex Row
+     * @return Pointer to wordsPerRow words
+     */
+    std::uint64_t* row(int rowIndex) {
+        return bitWords.data() + static_cast<std::size_t>(rowIndex) * wordsPerRow;
+    }
+
+    /**
+     * @brief First word of a row, read-only
+     * @param rowIndex Row
+     * @return Pointer to wordsPerRow words
+     */
+    const std::uint64_t* row(int rowIndex) const {
+        return bitWords.data() + static_cast<std::size_t>(rowIndex) * wordsPerRow;
+    }
+};
+
+/**
+ * @brief Answer structure of all-pairs reachability queries
+ * @details Vertices are grouped into strongly connected components; componentClosure has bit (a, b) set when
+ *          component b is reachable from component a by a path of at least one edge. For the Warshall path every
+ *          vertex is its own component.
+ */
+struct ReachabilityIndex {
+    std::vector<int> componentOfVertex;
+    BitPackedMatrix componentClosure;
+    int numberOfComponents;
+
+    /**
+     * @brief Default constructor
+     */
+    ReachabilityIndex() : numberOfComponents(0) {}
+};
+
+/**
+ * @brief OR one bit row into another
+ * @param targetRow Row that receives the bits
+ * @param sourceRow Row to add
+ * @param wordCount Number of 64-bit words, even
+ */
+inline void orBitRowInto(std::uint64_t* targetRow, const std::uint64_t* sourceRow, int wordCount) {
+#if defined(__SSE2__)
+    for (int wordIndex = 0; wordIndex < wordCount; wordIndex += 2) {
+        __m128i targetBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(targetRow + wordIndex));
+        __m128i sourceBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(sourceRow + wordIndex));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(targetRow + wordIndex), _mm_or_si128(targetBlock, sourceBlock));
+    }
+#else
+    for (int wordIndex = 0; wordIndex < wordCount; ++wordIndex) {
+        targetRow[wordIndex] |= sourceRow[wordIndex];
+    }
+#endif
+}
+
+/**
+ * @brief Test whether a vertex can reach another by a path of at least one edge
+ * @details One lookup of each component id and one bit test
+ * @param reachabilityIndex Index built by one of the closure functions
+ * @param sourceVertex Start vertex
+ * @param targetVertex End vertex
+ * @return True if targetVertex is reachable from sourceVertex
+ */
+inline bool canReach(const ReachabilityIndex& reachabilityIndex, int sourceVertex, int targetVertex) {
+    return reachabilityIndex.componentClosure.test(reachabilityIndex.componentOfVertex[sourceVertex],
+                                                   reachabilityIndex.componentOfVertex[targetVertex]);
+}
+
+/**
+ * @brief Transitive closure of a CSR graph by Warshall's algorithm on bit rows
+ * @details For every pivot k, each row that has bit k set takes the OR of row k. That is V^2 bit tests plus at most
+ *          V^2 row ORs of V/64 words, so O(V^3 / 64) time and V^2 / 8 bytes; meant for small or dense graphs.
+ * @param csrGraph Directed graph in CSR format; parallel edges and self-loops are allowed
+ * @return ReachabilityIndex with one component per vertex
+ */
+ReachabilityIndex computeTransitiveClosureWarshall(const CompressedSparseRow& csrGraph) {
+    int numberOfVertices = csrGraph.numberOfVertices;
+    ReachabilityIndex reachabilityIndex;
+    reachabilityIndex.numberOfComponents = numberOfVertices;
+    reachabilityIndex.componentOfVertex.resize(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        reachabilityIndex.componentOfVertex[vertexIndex] = vertexIndex;
+    }
+
+    BitPackedMatrix& closure = reachabilityIndex.componentClosure;
+    closure = BitPackedMatrix(numberOfVertices);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int position = csrGraph.rowOffsets[sourceVertex]; position < csrGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            closure.set(sourceVertex, csrGraph.columnIndices[position]);
+        }
+    }
+
+    int wordsPerRow = closure.wordsPerRow;
+    for (int pivotVertex = 0; pivotVertex < numberOfVertices; ++pivotVertex) {
+        const std::uint64_t* pivotRow = closure.row(pivotVertex);
+        int pivotWord = pivotVertex >> 6;
+        std::uint64_t pivotBit = 1ULL << (pivotVertex & 63);
+        for (int rowVertex = 0; rowVertex < numberOfVertices; ++rowVertex) {
+            std::uint64_t* currentRow = closure.row(rowVertex);
+            if ((currentRow[pivotWord] & pivotBit) != 0 && rowVertex != pivotVertex) {
+                orBitRowInto(currentRow, pivotRow, wordsPerRow);
+            }
+        }
+    }
+    return reachabilityIndex;
+}
+
+/**
+ * @brief Label strongly connected components with an iterative Tarjan search
+ * @details Components are numbered in the order Tarjan completes them, which is a reverse topological order of the
+ *          condensation: every edge between components goes from a higher id to a lower one
+ * @param csrGraph Directed graph in CSR format
+ * @param componentOfVertex Receives the component id of every vertex
+ * @return Number of components
+ */
+int computeStronglyConnectedComponents(const CompressedSparseRow& csrGraph, std::vector<int>& componentOfVertex) {
+    int numberOfVertices = csrGraph.numberOfVertices;
+    std::vector<int> discoveryIndex(numberOfVertices, -1);
+    std::vector<int> lowLink(numberOfVertices, 0);
+    std::vector<char> onComponentStack(numberOfVertices, 0);
+    std::vector<int> componentStack;
+    std::vector<std::pair<int, int>> callStack; // (vertex, next edge position)
+    componentOfVertex.assign(numberOfVertices, -1);
+    int nextDiscoveryIndex = 0;
+    int componentCount = 0;
+
+    for (int rootVertex = 0; rootVertex < numberOfVertices; ++rootVertex) {
+        if (discoveryIndex[rootVertex] != -1) {
+            continue;
+        }
+        discoveryIndex[rootVertex] = lowLink[rootVertex] = nextDiscoveryIndex++;
+        componentStack.push_back(rootVertex);
+        onComponentStack[rootVertex] = 1;
+        callStack.push_back({rootVertex, csrGraph.rowOffsets[rootVertex]});
+
+        while (!callStack.empty()) {
+            int currentVertex = callStack.back().first;
+            int& edgePosition = callStack.back().second;
+            if (edgePosition < csrGraph.rowOffsets[currentVertex + 1]) {
+                int neighbor = csrGraph.columnIndices[edgePosition++];
+                if (discoveryIndex[neighbor] == -1) {
+                    discoveryIndex[neighbor] = lowLink[neighbor] = nextDiscoveryIndex++;
+                    componentStack.push_back(neighbor);
+                    onComponentStack[neighbor] = 1;
+                    callStack.push_back({neighbor, csrGraph.rowOffsets[neighbor]});
+                } else if (onComponentStack[neighbor]) {
+                    lowLink[currentVertex] = std::min(lowLink[currentVertex], discoveryIndex[neighbor]);
+                }
+                continue;
+            }
+
+            callStack.pop_back();
+            if (lowLink[currentVertex] == discoveryIndex[currentVertex]) {
+                int memberVertex;
+                do {
+                    memberVertex = componentStack.back();
+                    componentStack.pop_back();
+                    onComponentStack[memberVertex] = 0;
+                    componentOfVertex[memberVertex] = componentCount;
+                } while (memberVertex != currentVertex);
+                componentCount++;
+            }
+            if (!callStack.empty()) {
+                int parentVertex = callStack.back().first;
+                lowLink[parentVertex] = std::min(lowLink[parentVertex], lowLink[currentVertex]);
+            }
+        }
+    }
+    return componentCount;
+}
+
+/**
+ * @brief Transitive closure of a CSR graph through its strongly connected component condensation
+ * @details Components are closed from sinks upward: the row of a component is the OR of {d} and the row of d over its
+ *          successor components d. Successors are visited from the topologically earliest down, and a successor whose
+ *          bit is already set is skipped, since its whole row is then already included. The matrix is C x C bits for
+ *          C components, so graphs with large components or few edges cost far less than V^3 / 64.
+ * @param csrGraph Directed graph in CSR format; parallel edges and self-loops are allowed
+ * @return ReachabilityIndex over the components
+ */
+ReachabilityIndex computeTransitiveClosureByCondensation(const CompressedSparseRow& csrGraph) {
+    int numberOfVertices = csrGraph.numberOfVertices;
+    ReachabilityIndex reachabilityIndex;
+    int componentCount = computeStronglyConnectedComponents(csrGraph, reachabilityIndex.componentOfVertex);
+    const std::vector<int>& componentOfVertex = reachabilityIndex.componentOfVertex;
+    reachabilityIndex.numberOfComponents = componentCount;
+
+    // Members of each component, contiguous, by counting sort
+    std::vector<int> memberOffsets(componentCount + 1, 0);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        memberOffsets[componentOfVertex[vertexIndex] + 1]++;
+    }
+    for (int componentIndex = 0; componentIndex < componentCount; ++componentIndex) {
+        memberOffsets[componentIndex + 1] += memberOffsets[componentIndex];
+    }
+    std::vector<int> componentMembers(numberOfVertices);
+    std::vector<int> fillPosition(memberOffsets.begin(), memberOffsets.end() - 1);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        componentMembers[fillPosition[componentOfVertex[vertexIndex]]++] = vertexIndex;
+    }
+
+    BitPackedMatrix& closure = reachabilityIndex.componentClosure;
+    closure = BitPackedMatrix(componentCount);
+    std::vector<int> lastSeenByComponent(componentCount, -1);
+    std::vector<int> successorComponents;
+    for (int componentIndex = 0; componentIndex < componentCount; ++componentIndex) {
+        bool isCyclic = memberOffsets[componentIndex + 1] - memberOffsets[componentIndex] > 1;
+        successorComponents.clear();
+        for (int memberPosition = memberOffsets[componentIndex]; memberPosition < memberOffsets[componentIndex + 1]; ++memberPosition) {
+            int memberVertex = componentMembers[memberPosition];
+            for (int position = csrGraph.rowOffsets[memberVertex]; position < csrGraph.rowOffsets[memberVertex + 1]; ++position) {
+                int successorComponent = componentOfVertex[csrGraph.columnIndices[position]];
+                if (successorComponent == componentIndex) {
+                    isCyclic = true;
+                } else if (lastSeenByComponent[successorComponent] != componentIndex) {
+                    lastSeenByComponent[successorComponent] = componentIndex;
+                    successorComponents.push_back(successorComponent);
+                }
+            }
+        }
+
+        // Higher ids are earlier in topological order and tend to reach the lower ones
+        std::sort(successorComponents.begin(), successorComponents.end(), std::greater<int>());
+        std::uint64_t* componentRow = closure.row(componentIndex);
+        for (int successorComponent : successorComponents) {
+            if (!closure.test(componentIndex, successorComponent)) {
+                closure.set(componentIndex, successorComponent);
+                orBitRowInto(componentRow, closure.row(successorComponent), closure.wordsPerRow);
+            }
+        }
+        if (isCyclic) {
+            closure.set(componentIndex, componentIndex);
+        }
+    }
+    return reachabilityIndex;
+}
+
+/**
+ * @brief Build the all-pairs reachability index, choosing the algorithm by graph size
+ * @details Small graphs use Warshall on the vertex matrix; larger ones go through the component condensation
+ * @param csrGraph Directed graph in CSR format
+ * @return ReachabilityIndex answering canReach in constant time
+ */
+ReachabilityIndex computeReachabilityIndex(const CompressedSparseRow& csrGraph) {
+    if (csrGraph.numberOfVertices <= WARSHALL_MAX_VERTEX_COUNT) {
+        return computeTransitiveClosureWarshall(csrGraph);
+    }
+    return computeTransitiveClosureByCondensation(csrGraph);
+}
+
+/**
+ * @brief Count the ordered vertex pairs (u, v) with v reachable from u
+ * @details A pair (u, u) counts only when u lies on a cycle
+ * @param reachabilityIndex Index built by one of the closure functions
+ * @return Number of vertex pairs with canReach(u, v) true
+ */
+long long countReachablePairs(const ReachabilityIndex& reachabilityIndex) {
+    std::vector<long long> componentSizes(reachabilityIndex.numberOfComponents, 0);
+    for (int componentIndex : reachabilityIndex.componentOfVertex) {
+        componentSizes[componentIndex]++;
+    }
+    long long pairCount = 0;
+    for (int sourceComponent = 0; sourceComponent < reachabilityIndex.numberOfComponents; ++sourceComponent) {
+        long long reachableVertices = 0;
+        for (int targetComponent = 0; targetComponent < reachabilityIndex.numberOfComponents; ++targetComponent) {
+            if (reachabilityIndex.componentClosure.test(sourceComponent, targetComponent)) {
+                reachableVertices += componentSizes[targetComponent];
+            }
+        }
+        pairCount += componentSizes[sourceComponent] * reachableVertices;
+    }
+    return pairCount;
+}
+
+/**
+ * @brief Compare two reachability indexes of the same graph pair by pair
+ * @details Quadratic in the vertex count, meant for checking small graphs
+ * @param leftIndex First index
+ * @param rightIndex Second index
+ * @return True if canReach agrees on every vertex pair
+ */
+bool areReachabilityIndexesEqual(const ReachabilityIndex& leftIndex, const ReachabilityIndex& rightIndex) {
+    int numberOfVertices = static_cast<int>(leftIndex.componentOfVertex.size());
+    if (numberOfVertices != static_cast<int>(rightIndex.componentOfVertex.size())) {
+        return false;
+    }
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            if (canReach(leftIndex, sourceVertex, targetVertex) != canReach(rightIndex, sourceVertex, targetVertex)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Check index rows against breadth-first searches from sample sources
+ * @param csrGraph Directed graph in CSR format
+ * @param reachabilityIndex Index built from csrGraph
+ * @param sampleSources Source vertices to check
+ * @return True if every sampled row matches
+ */
+bool verifyReachabilityIndex(const CompressedSparseRow& csrGraph, const ReachabilityIndex& reachabilityIndex,
+                             const std::vector<int>& sampleSources) {
+    std::vector<int> visitMarker(csrGraph.numberOfVertices, -1);
+    std::vector<int> vertexQueue;
+    for (int sourceVertex : sampleSources) {
+        // Paths of at least one edge: seed the queue with the direct successors
+        vertexQueue.clear();
+        for (int position = csrGraph.rowOffsets[sourceVertex]; position < csrGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            int neighbor = csrGraph.columnIndices[position];
+            if (visitMarker[neighbor] != sourceVertex) {
+                visitMarker[neighbor] = sourceVertex;
+                vertexQueue.push_back(neighbor);
+            }
+        }
+        for (std::size_t queueHead = 0; queueHead < vertexQueue.size(); ++queueHead) {
+            int currentVertex = vertexQueue[queueHead];
+            for (int position = csrGraph.rowOffsets[currentVertex]; position < csrGraph.rowOffsets[currentVertex + 1]; ++position) {
+                int neighbor = csrGraph.columnIndices[position];
+                if (visitMarker[neighbor] != sourceVertex) {
+                    visitMarker[neighbor] = sourceVertex;
+                    vertexQueue.push_back(neighbor);
+                }
+            }
+        }
+        for (int targetVertex = 0; targetVertex < csrGraph.numberOfVertices; ++targetVertex) {
+            if ((visitMarker[targetVertex] == sourceVertex) != canReach(reachabilityIndex, sourceVertex, targetVertex)) {
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+/**
+ * @brief Print the vertex reachability matrix, for small graphs
+ * @param reachabilityIndex Index built by one of the closure functions
+ */
+void displayReachabilityMatrix(const ReachabilityIndex& reachabilityIndex) {
+    int numberOfVertices = static_cast<int>(reachabilityIndex.componentOfVertex.size());
+    std::cout << "Reachability matrix (" << numberOfVertices << " vertices, " << reachabilityIndex.numberOfComponents
+              << " strongly connected components):" << std::endl;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        std::cout << "  " << sourceVertex << ":";
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            std::cout << " " << (canReach(reachabilityIndex, sourceVertex, targetVertex) ? 1 : 0);
+        }
+        std::cout << std::endl;
+    }
+}
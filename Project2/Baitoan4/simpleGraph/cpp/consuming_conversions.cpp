@@ -0,0 +1,283 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <map>
+#include <utility>
+
+/**
+ * @brief Apply simple graph rules to one neighbor row in place, keeping the first copy of every target
+ * @details Replaces the std::set of seen pairs used by the copying conversions with an O(V) stamp array
+ * @param neighborRow Row of target vertices, compacted in place
+ * @param sourceVertex Vertex that owns the row
+ * @param numberOfVertices Number of vertices in the graph
+ * @param seenForSource seenForSource[t] == sourceVertex once t has been kept for this row
+ * @param selfLoopCount Incremented for every self-loop dropped
+ * @param duplicateEdgeCount Incremented for every repeated target dropped
+ */
+void filterSimpleGraphRowInPlace(std::vector<int>& neighborRow, int sourceVertex, int numberOfVertices,
+                                 std::vector<int>& seenForSource, int& selfLoopCount, int& duplicateEdgeCount) {
+    std::size_t keptCount = 0;
+    for (std::size_t position = 0; position < neighborRow.size(); ++position) {
+        int targetVertex = neighborRow[position];
+        if (targetVertex == sourceVertex) {
+            selfLoopCount++;
+            continue;
+        }
+        if (targetVertex < 0 || targetVertex >= numberOfVertices) {
+            continue;
+        }
+        if (seenForSource[targetVertex] == sourceVertex) {
+            duplicateEdgeCount++;
+            continue;
+        }
+        seenForSource[targetVertex] = sourceVertex;
+        neighborRow[keptCount++] = targetVertex;
+    }
+    neighborRow.resize(keptCount);
+}
+
+/**
+ * @brief Print the same removal warnings as the copying conversions
+ * @param selfLoopCount Number of self-loops removed
+ * @param duplicateEdgeCount Number of duplicate edges removed
+ * @param targetName Name of the produced representation
+ */
+void reportConsumingConversionRemovals(int selfLoopCount, int duplicateEdgeCount, const std::string& targetName) {
+    if (selfLoopCount > 0) {
+        std::cout << "Warning: " << selfLoopCount << " self-loops removed during conversion to simple graph " << targetName << std::endl;
+    }
+    if (duplicateEdgeCount > 0) {
+        std::cout << "Warning: " << duplicateEdgeCount << " duplicate edges removed during conversion to simple graph " << targetName << std::endl;
+    }
+}
+
+/**
+ * @brief Convert extended adjacency list to adjacency list, consuming the source
+ * @details Each outgoing index row is rewritten in place into its target vertices and then becomes the
+ *          adjacency row, so no second E-sized buffer is allocated. Incoming indices are released first.
+ *          Assumes outgoingEdgeIndices[v] only holds edges whose source is v, as every builder produces.
+ * @param extendedList Extended adjacency list, left empty
+ * @return AdjacencyList structure containing the converted data
+ */
+AdjacencyList convertExtendedAdjacencyListToList(ExtendedAdjacencyList&& extendedList) {
+    int numberOfVertices = extendedList.numberOfVertices;
+    std::vector<std::vector<int>>().swap(extendedList.incomingEdgeIndices);
+
+    std::vector<int> seenForSource(numberOfVertices, -1);
+    int selfLoopCount = 0;
+    int duplicateEdgeCount = 0;
+    int edgeInstanceCount = static_cast<int>(extendedList.edgeInstances.size());
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        std::vector<int>& indexRow = extendedList.outgoingEdgeIndices[vertexIndex];
+        std::size_t validCount = 0;
+        for (int edgeIndex : indexRow) {
+            if (edgeIndex >= 0 && edgeIndex < edgeInstanceCount) {
+                indexRow[validCount++] = extendedList.edgeInstances[edgeIndex].second;
+            }
+        }
+        indexRow.resize(validCount);
+        filterSimpleGraphRowInPlace(indexRow, vertexIndex, numberOfVertices, seenForSource, selfLoopCount, duplicateEdgeCount);
+    }
+    std::vector<std::pair<int, int>>().swap(extendedList.edgeInstances);
+
+    AdjacencyList adjacencyList;
+    adjacencyList.numberOfVertices = numberOfVertices;
+    adjacencyList.adjacencyData = std::move(extendedList.outgoingEdgeIndices);
+    extendedList.outgoingEdgeIndices.clear();
+    extendedList.numberOfVertices = 0;
+    extendedList.numberOfEdges = 0;
+
+    reportConsumingConversionRemovals(selfLoopCount, duplicateEdgeCount, "list");
+    return adjacencyList;
+}
+
+/**
+ * @brief Convert adjacency list to extended adjacency list, consuming the source
+ * @details Each adjacency row is rewritten in place into edge indices and becomes the outgoing index row,
+ *          only edgeInstances and the incoming rows are newly allocated. Edge numbering matches the copying version.
+ * @param adjacencyList Adjacency list, left empty
+ * @return ExtendedAdjacencyList structure containing the converted data
+ */
+ExtendedAdjacencyList convertAdjacencyListToExtended(AdjacencyList&& adjacencyList) {
+    int numberOfVertices = adjacencyList.numberOfVertices;
+    std::vector<int> seenForSource(numberOfVertices, -1);
+    std::vector<int> incomingCounts(numberOfVertices, 0);
+    int selfLoopCount = 0;
+    int duplicateEdgeCount = 0;
+    std::size_t keptEdgeCount = 0;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        filterSimpleGraphRowInPlace(adjacencyList.adjacencyData[sourceVertex], sourceVertex, numberOfVertices,
+                                    seenForSource, selfLoopCount, duplicateEdgeCount);
+        keptEdgeCount += adjacencyList.adjacencyData[sourceVertex].size();
+        for (int targetVertex : adjacencyList.adjacencyData[sourceVertex]) {
+            incomingCounts[targetVertex]++;
+        }
+    }
+
+    ExtendedAdjacencyList extendedList;
+    extendedList.numberOfVertices = numberOfVertices;
+    extendedList.edgeInstances.reserve(keptEdgeCount);
+    extendedList.incomingEdgeIndices.resize(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        extendedList.incomingEdgeIndices[vertexIndex].reserve(incomingCounts[vertexIndex]);
+    }
+
+    int edgeCounter = 0;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int& rowEntry : adjacencyList.adjacencyData[sourceVertex]) {
+            int targetVertex = rowEntry;
+            extendedList.edgeInstances.push_back({sourceVertex, targetVertex});
+            extendedList.incomingEdgeIndices[targetVertex].push_back(edgeCounter);
+            rowEntry = edgeCounter++;
+        }
+    }
+    extendedList.outgoingEdgeIndices = std::move(adjacencyList.adjacencyData);
+    extendedList.numberOfEdges = edgeCounter;
+    adjacencyList.adjacencyData.clear();
+    adjacencyList.numberOfVertices = 0;
+
+    reportConsumingConversionRemovals(selfLoopCount, duplicateEdgeCount, "extended list");
+    return extendedList;
+}
+
+/**
+ * @brief Convert adjacency matrix to adjacency list, consuming the source
+ * @details Each matrix row is compacted in place into its non-zero column indices and shrunk,
+ *          so peak memory stays at one matrix plus one output row
+ * @param adjacencyMatrix Adjacency matrix, left empty
+ * @return AdjacencyList structure containing the converted data
+ */
+AdjacencyList convertMatrixToAdjacencyList(AdjacencyMatrix&& adjacencyMatrix) {
+    int numberOfVertices = adjacencyMatrix.numberOfVertices;
+    int selfLoopCount = 0;
+    int multipleEdgeCount = 0;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        std::vector<int>& matrixRow = adjacencyMatrix.matrixData[sourceVertex];
+        std::size_t keptCount = 0;
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            int edgeCount = matrixRow[targetVertex];
+            if (sourceVertex == targetVertex && edgeCount > 0) {
+                selfLoopCount += edgeCount;
+                continue;
+            }
+            if (edgeCount > 1) {
+                multipleEdgeCount += edgeCount - 1;
+            }
+            if (edgeCount > 0) {
+                matrixRow[keptCount++] = targetVertex;
+            }
+        }
+        matrixRow.resize(keptCount);
+        matrixRow.shrink_to_fit();
+    }
+
+    AdjacencyList adjacencyList;
+    adjacencyList.numberOfVertices = numberOfVertices;
+    adjacencyList.adjacencyData = std::move(adjacencyMatrix.matrixData);
+    adjacencyMatrix.matrixData.clear();
+    adjacencyMatrix.numberOfVertices = 0;
+
+    if (selfLoopCount > 0) {
+        std::cout << "Warning: " << selfLoopCount << " self-loops removed during conversion to simple graph list" << std::endl;
+    }
+    if (multipleEdgeCount > 0) {
+        std::cout << "Warning: " << multipleEdgeCount << " multiple edges converted to single edges during conversion to simple graph list" << std::endl;
+    }
+    return adjacencyList;
+}
+
+/**
+ * @brief Convert adjacency list to adjacency matrix, consuming the source
+ * @details Matrix rows are allocated one at a time and each source row is released right after,
+ *          so the list and the matrix are never both fully resident
+ * @param adjacencyList Adjacency list, left empty
+ * @return AdjacencyMatrix structure containing the converted data
+ */
+AdjacencyMatrix convertAdjacencyListToMatrix(AdjacencyList&& adjacencyList) {
+    int numberOfVertices = adjacencyList.numberOfVertices;
+    AdjacencyMatrix adjacencyMatrix;
+    adjacencyMatrix.numberOfVertices = numberOfVertices;
+    adjacencyMatrix.matrixData.resize(numberOfVertices);
+
+    std::vector<int> seenForSource(numberOfVertices, -1);
+    int selfLoopCount = 0;
+    int duplicateEdgeCount = 0;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        std::vector<int>& neighborRow = adjacencyList.adjacencyData[sourceVertex];
+        filterSimpleGraphRowInPlace(neighborRow, sourceVertex, numberOfVertices, seenForSource, selfLoopCount, duplicateEdgeCount);
+        adjacencyMatrix.matrixData[sourceVertex].assign(numberOfVertices, 0);
+        for (int targetVertex : neighborRow) {
+            adjacencyMatrix.matrixData[sourceVertex][targetVertex] = 1;
+        }
+        std::vector<int>().swap(neighborRow);
+    }
+    adjacencyList.adjacencyData.clear();
+    adjacencyList.numberOfVertices = 0;
+
+    reportConsumingConversionRemovals(selfLoopCount, duplicateEdgeCount, "matrix");
+    return adjacencyMatrix;
+}
+
+/**
+ * @brief Convert adjacency map to adjacency list, consuming the source
+ * @details Incoming connections are dropped up front and every outgoing map node is extracted and
+ *          freed as soon as its row is built
+ * @param adjacencyMap Adjacency map, left empty
+ * @return AdjacencyList structure containing the converted data
+ */
+AdjacencyList convertAdjacencyMapToList(AdjacencyMap&& adjacencyMap) {
+    int numberOfVertices = adjacencyMap.numberOfVertices;
+    adjacencyMap.incomingConnections.clear();
+
+    AdjacencyList adjacencyList(numberOfVertices);
+    std::vector<int> seenForSource(numberOfVertices, -1);
+    int selfLoopCount = 0;
+    int duplicateEdgeCount = 0;
+    while (!adjacencyMap.outgoingConnections.empty()) {
+        auto connectionsNode = adjacencyMap.outgoingConnections.extract(adjacencyMap.outgoingConnections.begin());
+        int sourceVertex = connectionsNode.key();
+        if (sourceVertex < 0 || sourceVertex >= numberOfVertices) {
+            continue;
+        }
+        std::vector<int>& neighborRow = adjacencyList.adjacencyData[sourceVertex];
+        neighborRow.reserve(connectionsNode.mapped().size());
+        for (const auto& connection : connectionsNode.mapped()) {
+            neighborRow.push_back(connection.first);
+        }
+        filterSimpleGraphRowInPlace(neighborRow, sourceVertex, numberOfVertices, seenForSource, selfLoopCount, duplicateEdgeCount);
+    }
+    adjacencyMap.numberOfVertices = 0;
+    adjacencyMap.numberOfEdges = 0;
+
+    reportConsumingConversionRemovals(selfLoopCount, duplicateEdgeCount, "list");
+    return adjacencyList;
+}
+
+/**
+ * @brief Convert adjacency list to adjacency map, consuming the source
+ * @details Each source row is released as soon as its connections are inserted
+ * @param adjacencyList Adjacency list, left empty
+ * @return AdjacencyMap structure containing the converted data
+ */
+AdjacencyMap convertAdjacencyListToMap(AdjacencyList&& adjacencyList) {
+    int numberOfVertices = adjacencyList.numberOfVertices;
+    AdjacencyMap adjacencyMap(numberOfVertices);
+    std::vector<int> seenForSource(numberOfVertices, -1);
+    int selfLoopCount = 0;
+    int duplicateEdgeCount = 0;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        std::vector<int>& neighborRow = adjacencyList.adjacencyData[sourceVertex];
+        filterSimpleGraphRowInPlace(neighborRow, sourceVertex, numberOfVertices, seenForSource, selfLoopCount, duplicateEdgeCount);
+        for (int targetVertex : neighborRow) {
+            adjacencyMap.outgoingConnections[sourceVertex].push_back({targetVertex, {sourceVertex, targetVertex}});
+            adjacencyMap.incomingConnections[targetVertex].push_back({sourceVertex, {sourceVertex, targetVertex}});
+            adjacencyMap.numberOfEdges++;
+        }
+        std::vector<int>().swap(neighborRow);
+    }
+    adjacencyList.adjacencyData.clear();
+    adjacencyList.numberOfVertices = 0;
+
+    reportConsumingConversionRemovals(selfLoopCount, duplicateEdgeCount, "map");
+    return adjacencyMap;
+}
@@ -196,14 +196,50 @@ ExtendedAdjacencyList convertMatrixToExtendedAdjacencyList(const std::vector<std
     return extendedList;
 }
 
+/**
+ * @brief Display extended adjacency list as degree histograms, top-degree vertices and sample rows
+ * @details Sampled rows show each outgoing edge as edgeIndex->target
+ * @param extendedList The extended adjacency list to summarize
+ */
+void displayExtendedAdjacencyListSummary(const ExtendedAdjacencyList& extendedList) {
+    std::vector<int> outDegrees(extendedList.numberOfVertices);
+    std::vector<int> inDegrees(extendedList.numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < extendedList.numberOfVertices; ++vertexIndex) {
+        outDegrees[vertexIndex] = static_cast<int>(extendedList.outgoingEdgeIndices[vertexIndex].size());
+        inDegrees[vertexIndex] = static_cast<int>(extendedList.incomingEdgeIndices[vertexIndex].size());
+    }
+    displayDegreeSummary(outDegrees, "Out-degree");
+    displayDegreeSummary(inDegrees, "In-degree");
+
+    displaySampleRows(extendedList.numberOfVertices, [&](int vertexIndex) {
+        const std::vector<int>& outgoingEdges = extendedList.outgoingEdgeIndices[vertexIndex];
+        std::cout << "Vertex " << vertexIndex << " outgoing: ";
+        if (outgoingEdges.empty()) {
+            std::cout << "(no outgoing edges)";
+        } else {
+            displayTruncatedRowEntries(outDegrees[vertexIndex], " ", [&](int entryIndex) {
+                int edgeIndex = outgoingEdges[entryIndex];
+                std::cout << edgeIndex << "->" << extendedList.edgeInstances[edgeIndex].second;
+            });
+        }
+        std::cout << std::endl;
+    });
+    std::cout << std::endl;
+}
+
 /**
  * @brief Display extended adjacency list to console
  * @param extendedList The extended adjacency list to display
+ * @param displayMode Full dump, summary, or Automatic (summary above FULL_DISPLAY_VERTEX_LIMIT vertices)
  */
-void displayExtendedAdjacencyList(const ExtendedAdjacencyList& extendedList) {
+void displayExtendedAdjacencyList(const ExtendedAdjacencyList& extendedList, GraphDisplayMode displayMode = GraphDisplayMode::Automatic) {
     std::cout << "=== Extended Adjacency List (SimpleGraph) ===" << std::endl;
     std::cout << "Number of vertices: " << extendedList.numberOfVertices << std::endl;
     std::cout << "Number of edges: " << extendedList.numberOfEdges << std::endl;
+    if (!shouldDisplayFullGraph(extendedList.numberOfVertices, displayMode)) {
+        displayExtendedAdjacencyListSummary(extendedList);
+        return;
+    }
     
     std::cout << "\nEdge instances:" << std::endl;
     for (int edgeIndex = 0; edgeIndex < extendedList.numberOfEdges; ++edgeIndex) {
@@ -0,0 +1,464 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <map>
+#include <algorithm>
+#include <chrono>
+#include <random>
+#include <cstdint>
+
+/**
+ * @brief Default number of neighbors between two skip entries
+ */
+const int GAP_SKIP_INTERVAL = 64;
+
+/**
+ * @brief Code used for the gaps of every neighbor list
+ */
+enum class GapEncoding {
+    Varint,
+    EliasGamma
+};
+
+/**
+ * @brief Resume point inside a neighbor list, placed every skipInterval neighbors
+ */
+struct GapSkipEntry {
+    int previousNeighbor;
+    std::uint64_t codeBitPosition;
+};
+
+/**
+ * @brief Structure to represent gap-encoded compressed adjacency for simple graph
+ * @details Each sorted neighbor list is stored as gaps neighbor - previous (previous starts at -1, so every gap is >= 1),
+ *          written as LEB128 varints or Elias-gamma codes. Vertex v owns bits [listBitOffsets[v], listBitOffsets[v + 1]),
+ *          its skip entries are skipEntries[skipOffsets[v] .. skipOffsets[v + 1]).
+ */
+struct GapEncodedAdjacency {
+    std::vector<std::uint8_t> encodedBytes;
+    std::vector<std::uint64_t> listBitOffsets;
+    std::vector<GapSkipEntry> skipEntries;
+    std::vector<int> skipOffsets;
+    int numberOfVertices;
+    int numberOfEdges;
+    int skipInterval;
+    GapEncoding gapEncoding;
+
+    /**
+     * @brief Default constructor
+     */
+    GapEncodedAdjacency() : numberOfVertices(0), numberOfEdges(0), skipInterval(GAP_SKIP_INTERVAL), gapEncoding(GapEncoding::Varint) {}
+
+    /**
+     * @brief Total bytes used by codes, list offsets and skip entries
+     * @return Memory footprint in bytes
+     */
+    std::size_t memoryBytes() const {
+        return encodedBytes.size() + listBitOffsets.size() * sizeof(std::uint64_t)
+             + skipEntries.size() * sizeof(GapSkipEntry) + skipOffsets.size() * sizeof(int);
+    }
+};
+
+/**
+ * @brief Append-only MSB-first bit writer
+ */
+struct GapBitWriter {
+    std::vector<std::uint8_t>& outputBytes;
+    std::uint64_t bitLength;
+
+    /**
+     * @brief Constructor over the destination buffer
+     * @param bytes Buffer to append to
+     */
+    GapBitWriter(std::vector<std::uint8_t>& bytes) : outputBytes(bytes), bitLength(0) {}
+
+    /**
+     * @brief Append the low bitCount bits of value, most significant first
+     * @param value Bits to append
+     * @param bitCount Number of bits, at most 32
+     */
+    void writeBits(std::uint32_t value, int bitCount) {
+        for (int bitIndex = bitCount - 1; bitIndex >= 0; --bitIndex) {
+            if ((bitLength & 7) == 0) {
+                outputBytes.push_back(0);
+            }
+            if ((value >> bitIndex) & 1) {
+                outputBytes.back() |= static_cast<std::uint8_t>(0x80 >> (bitLength & 7));
+            }
+            bitLength++;
+        }
+    }
+
+    /**
+     * @brief Append one gap with the chosen code
+     * @param gapValue Gap to append, at least 1
+     * @param gapEncoding Varint (byte aligned) or Elias-gamma
+     */
+    void writeGap(std::uint32_t gapValue, GapEncoding gapEncoding) {
+        if (gapEncoding == GapEncoding::Varint) {
+            while (gapValue >= 0x80) {
+                writeBits((gapValue & 0x7F) | 0x80, 8);
+                gapValue >>= 7;
+            }
+            writeBits(gapValue, 8);
+        } else {
+            int highestBit = 31 - __builtin_clz(gapValue);
+            writeBits(0, highestBit);
+            writeBits(gapValue, highestBit + 1);
+        }
+    }
+};
+
+/**
+ * @brief Load the 64 bits that start at an arbitrary bit position
+ * @details encodedBytes carries 8 bytes of zero padding, so the load never runs past the buffer
+ * @param encodedBytes Padded code buffer
+ * @param bitPosition Position of the first bit
+ * @return Window whose most significant bits are the bits at bitPosition (at least 57 valid bits)
+ */
+inline std::uint64_t peekGapBits(const std::vector<std::uint8_t>& encodedBytes, std::uint64_t bitPosition) {
+    const std::uint8_t* wordBytes = encodedBytes.data() + (bitPosition >> 3);
+    std::uint64_t bitWindow = 0;
+    for (int byteIndex = 0; byteIndex < 8; ++byteIndex) {
+        bitWindow = (bitWindow << 8) | wordBytes[byteIndex];
+    }
+    return bitWindow << (bitPosition & 7);
+}
+
+/**
+ * @brief Decode one gap and advance the bit position past it
+ * @param encodedBytes Padded code buffer
+ * @param bitPosition Position of the code, advanced in place
+ * @param gapEncoding Code used by the buffer
+ * @return Decoded gap
+ */
+inline std::uint32_t readGap(const std::vector<std::uint8_t>& encodedBytes, std::uint64_t& bitPosition, GapEncoding gapEncoding) {
+    if (gapEncoding == GapEncoding::Varint) {
+        const std::uint8_t* codeBytes = encodedBytes.data() + (bitPosition >> 3);
+        std::uint32_t gapValue = 0;
+        int shiftAmount = 0;
+        int byteCount = 0;
+        std::uint8_t codeByte;
+        do {
+            codeByte = codeBytes[byteCount++];
+            gapValue |= static_cast<std::uint32_t>(codeByte & 0x7F) << shiftAmount;
+            shiftAmount += 7;
+        } while (codeByte & 0x80);
+        bitPosition += 8 * byteCount;
+        return gapValue;
+    }
+
+    int leadingZeros = __builtin_clzll(peekGapBits(encodedBytes, bitPosition));
+    bitPosition += leadingZeros;
+    std::uint32_t gapValue = static_cast<std::uint32_t>(peekGapBits(encodedBytes, bitPosition) >> (63 - leadingZeros));
+    bitPosition += leadingZeros + 1;
+    return gapValue;
+}
+
+/**
+ * @brief Build gap-encoded adjacency from a row provider
+ * @param numberOfVertices Number of vertices in the graph
+ * @param collectRow Called as collectRow(vertex, row) to append the out-neighbors of a vertex to row
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency with sorted, duplicate-free and loop-free neighbor lists
+ */
+template <typename RowCollector>
+GapEncodedAdjacency buildGapEncodedAdjacency(int numberOfVertices, RowCollector collectRow,
+                                             GapEncoding gapEncoding, int skipInterval) {
+    GapEncodedAdjacency gapAdjacency;
+    gapAdjacency.numberOfVertices = numberOfVertices;
+    gapAdjacency.skipInterval = std::max(1, skipInterval);
+    gapAdjacency.gapEncoding = gapEncoding;
+    gapAdjacency.listBitOffsets.reserve(numberOfVertices + 1);
+    gapAdjacency.skipOffsets.reserve(numberOfVertices + 1);
+
+    GapBitWriter bitWriter(gapAdjacency.encodedBytes);
+    std::vector<int> neighborRow;
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        gapAdjacency.listBitOffsets.push_back(bitWriter.bitLength);
+        gapAdjacency.skipOffsets.push_back(static_cast<int>(gapAdjacency.skipEntries.size()));
+
+        neighborRow.clear();
+        collectRow(sourceVertex, neighborRow);
+        std::sort(neighborRow.begin(), neighborRow.end());
+        neighborRow.erase(std::unique(neighborRow.begin(), neighborRow.end()), neighborRow.end());
+        neighborRow.erase(std::remove(neighborRow.begin(), neighborRow.end(), sourceVertex), neighborRow.end());
+
+        int previousNeighbor = -1;
+        for (int neighborPosition = 0; neighborPosition < static_cast<int>(neighborRow.size()); ++neighborPosition) {
+            if (neighborPosition > 0 && neighborPosition % gapAdjacency.skipInterval == 0) {
+                gapAdjacency.skipEntries.push_back({previousNeighbor, bitWriter.bitLength});
+            }
+            bitWriter.writeGap(static_cast<std::uint32_t>(neighborRow[neighborPosition] - previousNeighbor), gapEncoding);
+            previousNeighbor = neighborRow[neighborPosition];
+        }
+        gapAdjacency.numberOfEdges += static_cast<int>(neighborRow.size());
+    }
+    gapAdjacency.listBitOffsets.push_back(bitWriter.bitLength);
+    gapAdjacency.skipOffsets.push_back(static_cast<int>(gapAdjacency.skipEntries.size()));
+
+    gapAdjacency.encodedBytes.resize(gapAdjacency.encodedBytes.size() + 8, 0);
+    gapAdjacency.encodedBytes.shrink_to_fit();
+    return gapAdjacency;
+}
+
+/**
+ * @brief Visit the neighbors of a vertex in increasing order, decoding on the fly
+ * @param gapAdjacency Gap-encoded adjacency
+ * @param sourceVertex Vertex whose neighbors are visited
+ * @param visitNeighbor Called as visitNeighbor(neighbor) for every neighbor
+ */
+template <typename NeighborVisitor>
+void forEachGapEncodedNeighbor(const GapEncodedAdjacency& gapAdjacency, int sourceVertex, NeighborVisitor visitNeighbor) {
+    std::uint64_t bitPosition = gapAdjacency.listBitOffsets[sourceVertex];
+    std::uint64_t listEnd = gapAdjacency.listBitOffsets[sourceVertex + 1];
+    int currentNeighbor = -1;
+    while (bitPosition < listEnd) {
+        currentNeighbor += static_cast<int>(readGap(gapAdjacency.encodedBytes, bitPosition, gapAdjacency.gapEncoding));
+        visitNeighbor(currentNeighbor);
+    }
+}
+
+/**
+ * @brief Check whether the edge source -> target exists, jumping over whole blocks with the skip entries
+ * @param gapAdjacency Gap-encoded adjacency
+ * @param sourceVertex Source vertex
+ * @param targetVertex Target vertex
+ * @return True if the edge exists
+ */
+bool hasGapEncodedEdge(const GapEncodedAdjacency& gapAdjacency, int sourceVertex, int targetVertex) {
+    std::uint64_t bitPosition = gapAdjacency.listBitOffsets[sourceVertex];
+    std::uint64_t listEnd = gapAdjacency.listBitOffsets[sourceVertex + 1];
+    int currentNeighbor = -1;
+
+    // Last skip entry whose previous neighbor is still below the target
+    auto skipBegin = gapAdjacency.skipEntries.begin() + gapAdjacency.skipOffsets[sourceVertex];
+    auto skipEnd = gapAdjacency.skipEntries.begin() + gapAdjacency.skipOffsets[sourceVertex + 1];
+    auto skipAfter = std::partition_point(skipBegin, skipEnd, [&](const GapSkipEntry& skipEntry) {
+        return skipEntry.previousNeighbor < targetVertex;
+    });
+    if (skipAfter != skipBegin) {
+        currentNeighbor = (skipAfter - 1)->previousNeighbor;
+        bitPosition = (skipAfter - 1)->codeBitPosition;
+    }
+
+    while (bitPosition < listEnd && currentNeighbor < targetVertex) {
+        currentNeighbor += static_cast<int>(readGap(gapAdjacency.encodedBytes, bitPosition, gapAdjacency.gapEncoding));
+    }
+    return currentNeighbor == targetVertex;
+}
+
+/**
+ * @brief Convert adjacency list to gap-encoded adjacency
+ * @param adjacencyData Adjacency list data
+ * @param numberOfVertices Number of vertices in the graph
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency structure containing the converted data
+ */
+GapEncodedAdjacency convertAdjacencyListToGapEncoded(const std::vector<std::vector<int>>& adjacencyData, int numberOfVertices,
+                                                     GapEncoding gapEncoding = GapEncoding::Varint,
+                                                     int skipInterval = GAP_SKIP_INTERVAL) {
+    return buildGapEncodedAdjacency(numberOfVertices, [&](int sourceVertex, std::vector<int>& neighborRow) {
+        neighborRow.insert(neighborRow.end(), adjacencyData[sourceVertex].begin(), adjacencyData[sourceVertex].end());
+    }, gapEncoding, skipInterval);
+}
+
+/**
+ * @brief Convert adjacency matrix to gap-encoded adjacency
+ * @param matrixData Adjacency matrix data
+ * @param numberOfVertices Number of vertices in the graph
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency structure containing the converted data
+ */
+GapEncodedAdjacency convertMatrixToGapEncoded(const std::vector<std::vector<int>>& matrixData, int numberOfVertices,
+                                              GapEncoding gapEncoding = GapEncoding::Varint,
+                                              int skipInterval = GAP_SKIP_INTERVAL) {
+    return buildGapEncodedAdjacency(numberOfVertices, [&](int sourceVertex, std::vector<int>& neighborRow) {
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            if (matrixData[sourceVertex][targetVertex] > 0) {
+                neighborRow.push_back(targetVertex);
+            }
+        }
+    }, gapEncoding, skipInterval);
+}
+
+/**
+ * @brief Convert extended adjacency list to gap-encoded adjacency
+ * @param edgeInstances List of edge instances
+ * @param outgoingEdgeIndices Outgoing edge indices for each vertex
+ * @param numberOfVertices Number of vertices in the graph
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency structure containing the converted data
+ */
+GapEncodedAdjacency convertExtendedAdjacencyListToGapEncoded(const std::vector<std::pair<int, int>>& edgeInstances,
+                                                             const std::vector<std::vector<int>>& outgoingEdgeIndices,
+                                                             int numberOfVertices,
+                                                             GapEncoding gapEncoding = GapEncoding::Varint,
+                                                             int skipInterval = GAP_SKIP_INTERVAL) {
+    return buildGapEncodedAdjacency(numberOfVertices, [&](int sourceVertex, std::vector<int>& neighborRow) {
+        for (int edgeIndex : outgoingEdgeIndices[sourceVertex]) {
+            neighborRow.push_back(edgeInstances[edgeIndex].second);
+        }
+    }, gapEncoding, skipInterval);
+}
+
+/**
+ * @brief Convert adjacency map to gap-encoded adjacency
+ * @param outgoingConnections Map of outgoing connections
+ * @param numberOfVertices Number of vertices in the graph
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency structure containing the converted data
+ */
+GapEncodedAdjacency convertAdjacencyMapToGapEncoded(const std::map<int, std::vector<std::pair<int, std::pair<int, int>>>>& outgoingConnections,
+                                                    int numberOfVertices,
+                                                    GapEncoding gapEncoding = GapEncoding::Varint,
+                                                    int skipInterval = GAP_SKIP_INTERVAL) {
+    return buildGapEncodedAdjacency(numberOfVertices, [&](int sourceVertex, std::vector<int>& neighborRow) {
+        auto connectionsIterator = outgoingConnections.find(sourceVertex);
+        if (connectionsIterator == outgoingConnections.end()) {
+            return;
+        }
+        for (const auto& connection : connectionsIterator->second) {
+            if (connection.first >= 0 && connection.first < numberOfVertices) {
+                neighborRow.push_back(connection.first);
+            }
+        }
+    }, gapEncoding, skipInterval);
+}
+
+/**
+ * @brief Convert CSR layout to gap-encoded adjacency
+ * @param csrGraph CSR structure
+ * @param gapEncoding Code used for the gaps
+ * @param skipInterval Number of neighbors between skip entries
+ * @return GapEncodedAdjacency structure containing the converted data
+ */
+GapEncodedAdjacency convertCompressedSparseRowToGapEncoded(const CompressedSparseRow& csrGraph,
+                                                           GapEncoding gapEncoding = GapEncoding::Varint,
+                                                           int skipInterval = GAP_SKIP_INTERVAL) {
+    return buildGapEncodedAdjacency(csrGraph.numberOfVertices, [&](int sourceVertex, std::vector<int>& neighborRow) {
+        neighborRow.insert(neighborRow.end(), csrGraph.columnIndices.begin() + csrGraph.rowOffsets[sourceVertex],
+                           csrGraph.columnIndices.begin() + csrGraph.rowOffsets[sourceVertex + 1]);
+    }, gapEncoding, skipInterval);
+}
+
+/**
+ * @brief Decode gap-encoded adjacency back to an adjacency list
+ * @param gapAdjacency Gap-encoded adjacency
+ * @return AdjacencyList with sorted neighbor lists
+ */
+AdjacencyList convertGapEncodedToAdjacencyList(const GapEncodedAdjacency& gapAdjacency) {
+    AdjacencyList adjacencyList(gapAdjacency.numberOfVertices);
+    for (int sourceVertex = 0; sourceVertex < gapAdjacency.numberOfVertices; ++sourceVertex) {
+        forEachGapEncodedNeighbor(gapAdjacency, sourceVertex, [&](int targetVertex) {
+            adjacencyList.adjacencyData[sourceVertex].push_back(targetVertex);
+        });
+    }
+    return adjacencyList;
+}
+
+/**
+ * @brief Display gap-encoded adjacency to console by decoding every list
+ * @param gapAdjacency The gap-encoded adjacency to display
+ */
+void displayGapEncodedAdjacency(const GapEncodedAdjacency& gapAdjacency) {
+    std::cout << "=== Gap-Encoded Adjacency ("
+              << (gapAdjacency.gapEncoding == GapEncoding::Varint ? "varint" : "Elias-gamma") << ") ===" << std::endl;
+    std::cout << "Number of vertices: " << gapAdjacency.numberOfVertices << std::endl;
+    std::cout << "Number of edges: " << gapAdjacency.numberOfEdges << std::endl;
+    std::cout << "Encoded size: " << gapAdjacency.memoryBytes() << " bytes" << std::endl;
+
+    for (int vertexIndex = 0; vertexIndex < gapAdjacency.numberOfVertices; ++vertexIndex) {
+        std::cout << "Vertex " << vertexIndex << ":";
+        bool hasNeighbors = false;
+        forEachGapEncodedNeighbor(gapAdjacency, vertexIndex, [&](int targetVertex) {
+            std::cout << " " << targetVertex;
+            hasNeighbors = true;
+        });
+        if (!hasNeighbors) {
+            std::cout << " (no outgoing edges)";
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Compare size, full-scan speed and probe speed of CSR against both gap encodings
+ * @param adjacencyList Graph to measure
+ * @param probeCount Number of random edge probes per representation
+ */
+void reportGapEncodedSpaceAndSpeed(const AdjacencyList& adjacencyList, int probeCount = 100000) {
+    CompressedSparseRow csrGraph(adjacencyList.numberOfVertices);
+    for (int sourceVertex = 0; sourceVertex < adjacencyList.numberOfVertices; ++sourceVertex) {
+        std::vector<int> sortedRow = adjacencyList.adjacencyData[sourceVertex];
+        std::sort(sortedRow.begin(), sortedRow.end());
+        csrGraph.columnIndices.insert(csrGraph.columnIndices.end(), sortedRow.begin(), sortedRow.end());
+        csrGraph.rowOffsets.push_back(static_cast<int>(csrGraph.columnIndices.size()));
+    }
+    csrGraph.numberOfEdges = static_cast<int>(csrGraph.columnIndices.size());
+
+    std::mt19937 probeGenerator(12345);
+    std::vector<std::pair<int, int>> probePairs(probeCount);
+    for (auto& probePair : probePairs) {
+        probePair = {static_cast<int>(probeGenerator() % std::max(1, csrGraph.numberOfVertices)),
+                     static_cast<int>(probeGenerator() % std::max(1, csrGraph.numberOfVertices))};
+    }
+
+    auto measureMicroseconds = [](auto timedWork) {
+        auto startTime = std::chrono::steady_clock::now();
+        timedWork();
+        return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - startTime).count();
+    };
+
+    std::cout << "=== Gap Encoding Space/Speed Report ===" << std::endl;
+    std::cout << "Vertices: " << csrGraph.numberOfVertices << ", edges: " << csrGraph.numberOfEdges
+              << ", probes: " << probeCount << std::endl;
+
+    long long csrNeighborSum = 0;
+    long long csrProbeHits = 0;
+    long long csrScanTime = measureMicroseconds([&]() {
+        for (int neighborVertex : csrGraph.columnIndices) {
+            csrNeighborSum += neighborVertex;
+        }
+    });
+    long long csrProbeTime = measureMicroseconds([&]() {
+        for (const auto& probePair : probePairs) {
+            csrProbeHits += std::binary_search(csrGraph.columnIndices.begin() + csrGraph.rowOffsets[probePair.first],
+                                               csrGraph.columnIndices.begin() + csrGraph.rowOffsets[probePair.first + 1],
+                                               probePair.second);
+        }
+    });
+    std::size_t csrBytes = (csrGraph.rowOffsets.size() + csrGraph.columnIndices.size()) * sizeof(int);
+    std::cout << "CSR:         " << csrBytes << " bytes, scan " << csrScanTime << " us, probes " << csrProbeTime << " us" << std::endl;
+
+    for (GapEncoding gapEncoding : {GapEncoding::Varint, GapEncoding::EliasGamma}) {
+        GapEncodedAdjacency gapAdjacency = convertCompressedSparseRowToGapEncoded(csrGraph, gapEncoding);
+        long long gapNeighborSum = 0;
+        long long gapProbeHits = 0;
+        long long gapScanTime = measureMicroseconds([&]() {
+            for (int sourceVertex = 0; sourceVertex < gapAdjacency.numberOfVertices; ++sourceVertex) {
+                forEachGapEncodedNeighbor(gapAdjacency, sourceVertex, [&](int neighborVertex) {
+                    gapNeighborSum += neighborVertex;
+                });
+            }
+        });
+        long long gapProbeTime = measureMicroseconds([&]() {
+            for (const auto& probePair : probePairs) {
+                gapProbeHits += hasGapEncodedEdge(gapAdjacency, probePair.first, probePair.second);
+            }
+        });
+        bool decodeMatches = gapNeighborSum == csrNeighborSum && gapProbeHits == csrProbeHits;
+        std::cout << (gapEncoding == GapEncoding::Varint ? "Varint:      " : "Elias-gamma: ")
+                  << gapAdjacency.memoryBytes() << " bytes ("
+                  << (csrBytes > 0 ? 100.0 * gapAdjacency.memoryBytes() / csrBytes : 0.0) << "% of CSR), scan "
+                  << gapScanTime << " us, probes " << gapProbeTime << " us"
+                  << (decodeMatches ? "" : " [MISMATCH]") << std::endl;
+    }
+    std::cout << std::endl;
+}
@@ -0,0 +1,255 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <map>
+#include <atomic>
+#include <cstdint>
+#include <cstdio>
+
+/**
+ * @brief Mix a 64-bit key into a well-distributed hash (splitmix64 finalizer)
+ * @param key Input key
+ * @return Hashed value
+ */
+inline std::uint64_t mixEdgeHash(std::uint64_t key) {
+    key += 0x9E3779B97F4A7C15ULL;
+    key = (key ^ (key >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    key = (key ^ (key >> 27)) * 0x94D049BB133111EBULL;
+    return key ^ (key >> 31);
+}
+
+/**
+ * @brief Pack a directed vertex pair into one 64-bit key
+ * @param sourceVertex Source vertex
+ * @param targetVertex Target vertex
+ * @return Packed key
+ */
+inline std::uint64_t packVertexPair(int sourceVertex, int targetVertex) {
+    return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(sourceVertex)) << 32) | static_cast<std::uint32_t>(targetVertex);
+}
+
+/**
+ * @brief Order-independent multiset hash of a graph's directed edge instances
+ * @details Each edge instance adds two independently seeded hashes of (source, target) modulo 2^64.
+ *          Addition commutes, so any storage order gives the same value, and a parallel edge
+ *          counts once per instance. Two graphs are equal with high probability iff fingerprints match.
+ */
+struct GraphFingerprint {
+    int numberOfVertices;
+    long long numberOfEdges;
+    std::uint64_t primaryHashSum;
+    std::uint64_t secondaryHashSum;
+
+    /**
+     * @brief Default constructor
+     */
+    GraphFingerprint() : numberOfVertices(0), numberOfEdges(0), primaryHashSum(0), secondaryHashSum(0) {}
+
+    /**
+     * @brief Add `multiplicity` instances of one directed edge
+     * @param sourceVertex Source vertex
+     * @param targetVertex Target vertex
+     * @param multiplicity Number of instances
+     */
+    void addEdgeInstances(int sourceVertex, int targetVertex, int multiplicity = 1) {
+        std::uint64_t edgeKey = packVertexPair(sourceVertex, targetVertex);
+        primaryHashSum += mixEdgeHash(edgeKey) * static_cast<std::uint64_t>(multiplicity);
+        secondaryHashSum += mixEdgeHash(edgeKey ^ 0xD6E8FEB86659FD93ULL) * static_cast<std::uint64_t>(multiplicity);
+        numberOfEdges += multiplicity;
+    }
+
+    /**
+     * @brief Compare two fingerprints
+     * @param other Fingerprint to compare with
+     * @return True if both describe the same vertex count and edge multiset
+     */
+    bool operator==(const GraphFingerprint& other) const {
+        return numberOfVertices == other.numberOfVertices && numberOfEdges == other.numberOfEdges &&
+               primaryHashSum == other.primaryHashSum && secondaryHashSum == other.secondaryHashSum;
+    }
+
+    /**
+     * @brief Compare two fingerprints
+     * @param other Fingerprint to compare with
+     * @return True if the fingerprints differ
+     */
+    bool operator!=(const GraphFingerprint& other) const {
+        return !(*this == other);
+    }
+};
+
+/**
+ * @brief Hash blocks of items on worker threads and add the partial fingerprints together
+ * @param numberOfVertices Vertex count recorded in the fingerprint
+ * @param itemCount Number of items (rows or edges) to split across threads
+ * @param hashRange Called as hashRange(begin, end, partialFingerprint) once per block
+ * @return Combined fingerprint
+ */
+template <typename RangeHasher>
+GraphFingerprint computeFingerprintInParallel(int numberOfVertices, int itemCount, RangeHasher hashRange) {
+    std::atomic<std::uint64_t> primaryTotal(0);
+    std::atomic<std::uint64_t> secondaryTotal(0);
+    std::atomic<long long> edgeTotal(0);
+    runParallelForRange(itemCount, [&](int rangeBegin, int rangeEnd) {
+        GraphFingerprint partialFingerprint;
+        hashRange(rangeBegin, rangeEnd, partialFingerprint);
+        primaryTotal += partialFingerprint.primaryHashSum;
+        secondaryTotal += partialFingerprint.secondaryHashSum;
+        edgeTotal += partialFingerprint.numberOfEdges;
+    });
+
+    GraphFingerprint graphFingerprint;
+    graphFingerprint.numberOfVertices = numberOfVertices;
+    graphFingerprint.numberOfEdges = edgeTotal;
+    graphFingerprint.primaryHashSum = primaryTotal;
+    graphFingerprint.secondaryHashSum = secondaryTotal;
+    return graphFingerprint;
+}
+
+/**
+ * @brief Fingerprint an adjacency matrix; every cell is visited, so this is O(V^2)
+ * @param adjacencyMatrix The adjacency matrix
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeAdjacencyMatrixFingerprint(const AdjacencyMatrix& adjacencyMatrix) {
+    return computeFingerprintInParallel(adjacencyMatrix.numberOfVertices, adjacencyMatrix.numberOfVertices,
+                                        [&](int rowBegin, int rowEnd, GraphFingerprint& partialFingerprint) {
+        for (int rowIndex = rowBegin; rowIndex < rowEnd; ++rowIndex) {
+            for (int columnIndex = 0; columnIndex < adjacencyMatrix.numberOfVertices; ++columnIndex) {
+                if (adjacencyMatrix.matrixData[rowIndex][columnIndex] > 0) {
+                    partialFingerprint.addEdgeInstances(rowIndex, columnIndex, adjacencyMatrix.matrixData[rowIndex][columnIndex]);
+                }
+            }
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint an adjacency list in O(V + E)
+ * @param adjacencyList The adjacency list
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeAdjacencyListFingerprint(const AdjacencyList& adjacencyList) {
+    return computeFingerprintInParallel(adjacencyList.numberOfVertices, adjacencyList.numberOfVertices,
+                                        [&](int vertexBegin, int vertexEnd, GraphFingerprint& partialFingerprint) {
+        for (int vertexIndex = vertexBegin; vertexIndex < vertexEnd; ++vertexIndex) {
+            for (int neighbor : adjacencyList.adjacencyData[vertexIndex]) {
+                partialFingerprint.addEdgeInstances(vertexIndex, neighbor);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint an extended adjacency list from its edge instances in O(E)
+ * @param extendedList The extended adjacency list
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeExtendedAdjacencyListFingerprint(const ExtendedAdjacencyList& extendedList) {
+    return computeFingerprintInParallel(extendedList.numberOfVertices, static_cast<int>(extendedList.edgeInstances.size()),
+                                        [&](int edgeBegin, int edgeEnd, GraphFingerprint& partialFingerprint) {
+        for (int edgeIndex = edgeBegin; edgeIndex < edgeEnd; ++edgeIndex) {
+            partialFingerprint.addEdgeInstances(extendedList.edgeInstances[edgeIndex].first,
+                                                extendedList.edgeInstances[edgeIndex].second);
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint an adjacency map from its outgoing connections in O(V + E)
+ * @param adjacencyMap The adjacency map
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeAdjacencyMapFingerprint(const AdjacencyMap& adjacencyMap) {
+    // std::map has no random access, so gather the rows first to split them across threads
+    std::vector<const std::pair<const int, std::vector<std::pair<int, std::pair<int, int>>>>*> mapRows;
+    mapRows.reserve(adjacencyMap.outgoingConnections.size());
+    for (const auto& vertexPair : adjacencyMap.outgoingConnections) {
+        mapRows.push_back(&vertexPair);
+    }
+
+    return computeFingerprintInParallel(adjacencyMap.numberOfVertices, static_cast<int>(mapRows.size()),
+                                        [&](int rowBegin, int rowEnd, GraphFingerprint& partialFingerprint) {
+        for (int rowIndex = rowBegin; rowIndex < rowEnd; ++rowIndex) {
+            for (const auto& connection : mapRows[rowIndex]->second) {
+                partialFingerprint.addEdgeInstances(mapRows[rowIndex]->first, connection.first);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint a CSR layout in O(V + E)
+ * @param csrGraph The CSR structure
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeCompressedSparseRowFingerprint(const CompressedSparseRow& csrGraph) {
+    return computeFingerprintInParallel(csrGraph.numberOfVertices, csrGraph.numberOfVertices,
+                                        [&](int vertexBegin, int vertexEnd, GraphFingerprint& partialFingerprint) {
+        for (int vertexIndex = vertexBegin; vertexIndex < vertexEnd; ++vertexIndex) {
+            for (int position = csrGraph.rowOffsets[vertexIndex]; position < csrGraph.rowOffsets[vertexIndex + 1]; ++position) {
+                partialFingerprint.addEdgeInstances(vertexIndex, csrGraph.columnIndices[position]);
+            }
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint a gap-encoded adjacency by decoding each row in place
+ * @param gapAdjacency The gap-encoded adjacency
+ * @return GraphFingerprint of its edge instances
+ */
+GraphFingerprint computeGapEncodedAdjacencyFingerprint(const GapEncodedAdjacency& gapAdjacency) {
+    return computeFingerprintInParallel(gapAdjacency.numberOfVertices, gapAdjacency.numberOfVertices,
+                                        [&](int vertexBegin, int vertexEnd, GraphFingerprint& partialFingerprint) {
+        for (int vertexIndex = vertexBegin; vertexIndex < vertexEnd; ++vertexIndex) {
+            forEachGapEncodedNeighbor(gapAdjacency, vertexIndex, [&](int neighbor) {
+                partialFingerprint.addEdgeInstances(vertexIndex, neighbor);
+            });
+        }
+    });
+}
+
+/**
+ * @brief Fingerprint the raw edge multiset of an edge list file without building a representation
+ * @details Self-loops and duplicates are hashed as they appear, so this matches a representation
+ *          only when reading the file drops nothing
+ * @param fileName Name of input file containing edge list
+ * @return GraphFingerprint of the listed edges
+ */
+GraphFingerprint computeEdgeListFileFingerprint(const std::string& fileName) {
+    GraphFingerprint fileFingerprint;
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return fileFingerprint;
+    }
+
+    long long numberOfEdges;
+    inputFile >> fileFingerprint.numberOfVertices >> numberOfEdges;
+    for (long long edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex) {
+        int sourceVertex, targetVertex;
+        if (!(inputFile >> sourceVertex >> targetVertex)) {
+            break;
+        }
+        fileFingerprint.addEdgeInstances(sourceVertex, targetVertex);
+    }
+
+    inputFile.close();
+    return fileFingerprint;
+}
+
+/**
+ * @brief Format a fingerprint as a compact string usable as a cache key
+ * @param graphFingerprint The fingerprint
+ * @return "V:E:hhhhhhhhhhhhhhhhhhhhhhhhhhhhhhhh"
+ */
+std::string formatGraphFingerprint(const GraphFingerprint& graphFingerprint) {
+    char hashText[33];
+    std::snprintf(hashText, sizeof(hashText), "%016llx%016llx",
+                  static_cast<unsigned long long>(graphFingerprint.primaryHashSum),
+                  static_cast<unsigned long long>(graphFingerprint.secondaryHashSum));
+    return std::to_string(graphFingerprint.numberOfVertices) + ":" +
+           std::to_string(graphFingerprint.numberOfEdges) + ":" + hashText;
+}
@@ -1,10 +1,28 @@
+#include "display_summary.cpp"
 #include "adjacency_matrix.cpp"
 #include "adjacency_list.cpp"
 #include "extended_adjacency_list.cpp"
 #include "adjacency_map.cpp"
+#include "compressed_sparse_row.cpp"
+#include "parallel_for.cpp"
+#include "triangle_counting.cpp"
+#include "gap_encoded_adjacency.cpp"
+#include "neighborhood_similarity.cpp"
+#include "neighbor_views.cpp"
+#include "consuming_conversions.cpp"
+#include "graph_fingerprint.cpp"
+#include "subgraph_extraction.cpp"
+#include "link_analysis.cpp"
+#include "core_decomposition.cpp"
+#include "pipelined_ingest.cpp"
+#include "transitive_closure.cpp"
 #include <iostream>
+#include <vector>
 #include <fstream>
 #include <string>
+#include <algorithm>
+#include <cstdio>
+#include <chrono>
 
 /**
  * @brief Demonstrate all 12 conversion functions between graph representations for simple graph
@@ -163,6 +181,446 @@ void testSimpleGraphMatrixInputFormat() {
     displayAdjacencyList(listFromMatrix);
 }
 
+/**
+ * @brief Test streaming matrix reader that skips zero cells instead of allocating V x V for simple graph
+ */
+void testSimpleGraphSparseMatrixReader() {
+    std::cout << "\n=== Testing SimpleGraph Sparse Matrix Reader ===" << std::endl;
+    
+    CompressedSparseRow csrFromFile = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into CSR:" << std::endl;
+    displayCompressedSparseRow(csrFromFile);
+    
+    AdjacencyList listFromFile = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    std::cout << "Matrix streamed directly into Adjacency List:" << std::endl;
+    displayAdjacencyList(listFromFile);
+}
+
+/**
+ * @brief Test triangle counting engine, all three modes must agree
+ */
+void testSimpleGraphTriangleCounting() {
+    std::cout << "\n=== Testing SimpleGraph Triangle Counting ===" << std::endl;
+    
+    AdjacencyList listFromFile = readAdjacencyListFromEdgeList("input.txt");
+    TriangleCountResult automaticResult = countTriangles(listFromFile);
+    displayTriangleCountResult(automaticResult);
+    
+    CompressedSparseRow undirectedGraph = buildUndirectedCompressedSparseRow(listFromFile.adjacencyData, listFromFile.numberOfVertices);
+    TriangleCountResult bitMatrixResult = countTrianglesWithBitMatrix(undirectedGraph);
+    TriangleCountResult sortedMergeResult = countTrianglesWithSortedMerge(undirectedGraph);
+    TriangleCountResult parallelResult = countTrianglesWithSortedMergeParallel(undirectedGraph);
+    bool modesAgree = bitMatrixResult.vertexTriangleCounts == sortedMergeResult.vertexTriangleCounts &&
+                      sortedMergeResult.vertexTriangleCounts == parallelResult.vertexTriangleCounts;
+    std::cout << "Bit-matrix, sorted-merge and parallel counts agree: " << (modesAgree ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test gap-encoded adjacency conversions, probes and space/speed report
+ */
+void testSimpleGraphGapEncodedAdjacency() {
+    std::cout << "\n=== Testing SimpleGraph Gap-Encoded Adjacency ===" << std::endl;
+    
+    AdjacencyList listFromFile = readAdjacencyListFromEdgeList("input.txt");
+    GapEncodedAdjacency varintAdjacency = convertAdjacencyListToGapEncoded(listFromFile.adjacencyData, listFromFile.numberOfVertices);
+    displayGapEncodedAdjacency(varintAdjacency);
+    
+    AdjacencyMatrix matrixFromList = convertAdjacencyListToMatrix(listFromFile.adjacencyData, listFromFile.numberOfVertices);
+    GapEncodedAdjacency gammaAdjacency = convertMatrixToGapEncoded(matrixFromList.matrixData, matrixFromList.numberOfVertices,
+                                                                  GapEncoding::EliasGamma, 2);
+    displayGapEncodedAdjacency(gammaAdjacency);
+    
+    bool probesMatch = true;
+    for (int sourceVertex = 0; sourceVertex < listFromFile.numberOfVertices; ++sourceVertex) {
+        for (int targetVertex = 0; targetVertex < listFromFile.numberOfVertices; ++targetVertex) {
+            bool edgeExists = matrixFromList.matrixData[sourceVertex][targetVertex] > 0;
+            probesMatch = probesMatch && hasGapEncodedEdge(varintAdjacency, sourceVertex, targetVertex) == edgeExists
+                                      && hasGapEncodedEdge(gammaAdjacency, sourceVertex, targetVertex) == edgeExists;
+        }
+    }
+    std::cout << "Edge probes match adjacency matrix: " << (probesMatch ? "yes" : "no") << std::endl;
+    
+    AdjacencyList decodedList = convertGapEncodedToAdjacencyList(gammaAdjacency);
+    std::cout << "Decoded back to Adjacency List:" << std::endl;
+    displayAdjacencyList(decodedList);
+    
+    reportGapEncodedSpaceAndSpeed(listFromFile, 1000);
+}
+
+/**
+ * @brief Test batch common-neighbor and Jaccard queries through pair files
+ */
+void testSimpleGraphNeighborhoodSimilarity() {
+    std::cout << "\n=== Testing SimpleGraph Neighborhood Similarity Queries ===" << std::endl;
+    
+    AdjacencyList listFromFile = readAdjacencyListFromEdgeList("input.txt");
+    CompressedSparseRow neighborhoodIndex = buildNeighborhoodIndex(listFromFile, true);
+    
+    std::ofstream queryFile("similarity_queries.txt");
+    queryFile << "4" << std::endl;
+    queryFile << "0 1" << std::endl;
+    queryFile << "1 4" << std::endl;
+    queryFile << "2 3" << std::endl;
+    queryFile << "0 7" << std::endl;
+    queryFile.close();
+    
+    std::vector<std::pair<int, int>> queryPairs = readVertexPairQueriesFromFile("similarity_queries.txt");
+    std::vector<NeighborhoodSimilarity> queryAnswers = answerNeighborhoodSimilarityQueries(neighborhoodIndex, queryPairs);
+    writeNeighborhoodSimilarityAnswersToFile(queryPairs, queryAnswers, "similarity_answers.txt");
+    
+    std::ifstream answerFile("similarity_answers.txt");
+    std::string answerLine;
+    std::cout << "Answers (u v common jaccard) over undirected neighborhoods:" << std::endl;
+    while (std::getline(answerFile, answerLine)) {
+        std::cout << answerLine << std::endl;
+    }
+    answerFile.close();
+    
+    std::remove("similarity_queries.txt");
+    std::remove("similarity_answers.txt");
+}
+
+/**
+ * @brief Test zero-copy neighbor views, the same generic algorithm runs over every representation
+ */
+void testSimpleGraphNeighborViews() {
+    std::cout << "\n=== Testing SimpleGraph Zero-Copy Neighbor Views ===" << std::endl;
+    
+    AdjacencyMatrix matrixFromFile = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList listFromMatrix = convertMatrixToAdjacencyList(matrixFromFile.matrixData, matrixFromFile.numberOfVertices);
+    ExtendedAdjacencyList extendedFromList = convertAdjacencyListToExtended(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    AdjacencyMap mapFromList = convertAdjacencyListToMap(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    GapEncodedAdjacency gapFromList = convertAdjacencyListToGapEncoded(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    
+    displayNeighborView(viewNeighbors(matrixFromFile), "Matrix as Neighbor Lists");
+    displayNeighborView(viewNeighbors(extendedFromList), "Extended List as Plain List");
+    
+    std::vector<int> referenceOrder = computeBreadthFirstOrderOverView(viewNeighbors(listFromMatrix), 0);
+    bool ordersAgree = referenceOrder == computeBreadthFirstOrderOverView(viewNeighbors(matrixFromFile), 0) &&
+                       referenceOrder == computeBreadthFirstOrderOverView(viewNeighbors(extendedFromList), 0) &&
+                       referenceOrder == computeBreadthFirstOrderOverView(viewNeighbors(mapFromList), 0) &&
+                       referenceOrder == computeBreadthFirstOrderOverView(viewNeighbors(gapFromList), 0);
+    std::cout << "BFS order from vertex 0:";
+    for (int vertexIndex : referenceOrder) {
+        std::cout << " " << vertexIndex;
+    }
+    std::cout << std::endl;
+    std::cout << "Same order through matrix, extended, map and gap-encoded views: " << (ordersAgree ? "yes" : "no") << std::endl;
+    std::cout << "Edges counted through map view: " << countNeighborViewEdges(viewNeighbors(mapFromList)) << std::endl;
+}
+
+/**
+ * @brief Test consuming conversions, a pipeline of moves must end with the same graph as the copying path
+ */
+void testSimpleGraphConsumingConversions() {
+    std::cout << "\n=== Testing SimpleGraph Consuming Conversions ===" << std::endl;
+    
+    AdjacencyMatrix matrixFromFile = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList referenceList = convertMatrixToAdjacencyList(matrixFromFile.matrixData, matrixFromFile.numberOfVertices);
+    ExtendedAdjacencyList referenceExtended = convertAdjacencyListToExtended(referenceList.adjacencyData, referenceList.numberOfVertices);
+    
+    // Every step hands its buffers to the next representation
+    AdjacencyList movedList = convertMatrixToAdjacencyList(std::move(matrixFromFile));
+    ExtendedAdjacencyList movedExtended = convertAdjacencyListToExtended(std::move(movedList));
+    bool extendedMatches = movedExtended.edgeInstances == referenceExtended.edgeInstances &&
+                           movedExtended.outgoingEdgeIndices == referenceExtended.outgoingEdgeIndices &&
+                           movedExtended.incomingEdgeIndices == referenceExtended.incomingEdgeIndices;
+    AdjacencyList listFromExtended = convertExtendedAdjacencyListToList(std::move(movedExtended));
+    AdjacencyMap movedMap = convertAdjacencyListToMap(std::move(listFromExtended));
+    AdjacencyList listFromMap = convertAdjacencyMapToList(std::move(movedMap));
+    AdjacencyMatrix matrixFromMoves = convertAdjacencyListToMatrix(std::move(listFromMap));
+    
+    std::cout << "Matrix after Matrix -> List -> Extended -> List -> Map -> List -> Matrix moves:" << std::endl;
+    displayAdjacencyMatrix(matrixFromMoves);
+    std::cout << "Moved extended list matches copying conversion: " << (extendedMatches ? "yes" : "no") << std::endl;
+    std::cout << "Sources left empty: " << (movedExtended.edgeInstances.empty() && movedMap.outgoingConnections.empty() ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test summary display on a generated graph too large for a readable full dump
+ */
+void testSimpleGraphSummaryDisplay() {
+    std::cout << "\n=== Testing SimpleGraph Summary Display ===" << std::endl;
+    
+    // Every third vertex links to hub 0, the rest get a spread of 0-8 targets
+    const int GENERATED_VERTEX_COUNT = 2000;
+    std::vector<std::vector<int>> generatedData(GENERATED_VERTEX_COUNT);
+    for (int sourceVertex = 1; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        if (sourceVertex % 3 == 0) {
+            generatedData[sourceVertex].push_back(0);
+        }
+        for (int targetRank = 0; targetRank < sourceVertex % 9; ++targetRank) {
+            generatedData[sourceVertex].push_back((sourceVertex * 7 + targetRank * 13 + 1) % GENERATED_VERTEX_COUNT);
+        }
+    }
+    
+    AdjacencyMatrix generatedMatrix = convertAdjacencyListToMatrix(generatedData, GENERATED_VERTEX_COUNT);
+    AdjacencyList generatedList = convertMatrixToAdjacencyList(generatedMatrix.matrixData, GENERATED_VERTEX_COUNT);
+    ExtendedAdjacencyList generatedExtended = convertAdjacencyListToExtended(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    AdjacencyMap generatedMap = convertAdjacencyListToMap(generatedList.adjacencyData, GENERATED_VERTEX_COUNT);
+    CompressedSparseRow generatedCsr;
+    generatedCsr.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedCsr.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& neighbors : generatedList.adjacencyData) {
+        generatedCsr.columnIndices.insert(generatedCsr.columnIndices.end(), neighbors.begin(), neighbors.end());
+        generatedCsr.rowOffsets.push_back(static_cast<int>(generatedCsr.columnIndices.size()));
+    }
+    generatedCsr.numberOfEdges = static_cast<int>(generatedCsr.columnIndices.size());
+    
+    // Automatic mode switches to the summary above FULL_DISPLAY_VERTEX_LIMIT vertices
+    displayAdjacencyMatrix(generatedMatrix);
+    displayAdjacencyList(generatedList);
+    displayExtendedAdjacencyList(generatedExtended);
+    displayAdjacencyMap(generatedMap);
+    displayCompressedSparseRow(generatedCsr);
+    
+    std::cout << "Small input forced into summary mode:" << std::endl;
+    displayAdjacencyList(readAdjacencyListFromEdgeList("input.txt"), GraphDisplayMode::Summary);
+}
+
+/**
+ * @brief Test that every representation of one graph hashes to the same fingerprint
+ */
+void testSimpleGraphFingerprints() {
+    std::cout << "\n=== Testing SimpleGraph Fingerprints ===" << std::endl;
+    
+    AdjacencyMatrix matrixFromFile = readAdjacencyMatrixFromEdgeList("input.txt");
+    AdjacencyList listFromMatrix = convertMatrixToAdjacencyList(matrixFromFile.matrixData, matrixFromFile.numberOfVertices);
+    ExtendedAdjacencyList extendedFromList = convertAdjacencyListToExtended(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices);
+    AdjacencyMap mapFromExtended = convertExtendedListToMap(extendedFromList.outgoingEdgeIndices, extendedFromList.incomingEdgeIndices,
+                                                            extendedFromList.edgeInstances, extendedFromList.numberOfVertices,
+                                                            extendedFromList.numberOfEdges);
+    AdjacencyMatrix matrixFromMap = convertAdjacencyMapToMatrix(mapFromExtended.outgoingConnections, mapFromExtended.numberOfVertices);
+    
+    GraphFingerprint matrixFingerprint = computeAdjacencyMatrixFingerprint(matrixFromFile);
+    std::cout << "Matrix fingerprint: " << formatGraphFingerprint(matrixFingerprint) << std::endl;
+    std::cout << "List matches: " << (computeAdjacencyListFingerprint(listFromMatrix) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Extended list matches: " << (computeExtendedAdjacencyListFingerprint(extendedFromList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Map matches: " << (computeAdjacencyMapFingerprint(mapFromExtended) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Matrix -> List -> Extended -> Map -> Matrix matches: "
+              << (computeAdjacencyMatrixFingerprint(matrixFromMap) == matrixFingerprint ? "yes" : "no") << std::endl;
+    std::cout << "Gap-encoded adjacency matches: "
+              << (computeGapEncodedAdjacencyFingerprint(convertAdjacencyListToGapEncoded(listFromMatrix.adjacencyData, listFromMatrix.numberOfVertices)) == matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    // Row order must not matter, an extra edge instance must
+    AdjacencyList reorderedList = listFromMatrix;
+    for (std::vector<int>& neighbors : reorderedList.adjacencyData) {
+        std::reverse(neighbors.begin(), neighbors.end());
+    }
+    std::cout << "Reordered rows match: " << (computeAdjacencyListFingerprint(reorderedList) == matrixFingerprint ? "yes" : "no") << std::endl;
+    reorderedList.adjacencyData[0].push_back(reorderedList.numberOfVertices - 1);
+    std::cout << "One extra edge differs: " << (computeAdjacencyListFingerprint(reorderedList) != matrixFingerprint ? "yes" : "no") << std::endl;
+    
+    GraphFingerprint fileFingerprint = computeEdgeListFileFingerprint("input.txt");
+    std::cout << "Raw edge list fingerprint: " << formatGraphFingerprint(fileFingerprint)
+              << (fileFingerprint == matrixFingerprint ? " (same as matrix)" : " (differs: reader dropped edges)") << std::endl;
+}
+
+/**
+ * @brief Test induced-subgraph and edge-filter extraction from CSR and adjacency list using matrix_input.txt
+ */
+void testSimpleGraphSubgraphExtraction() {
+    std::cout << "\n=== Testing Subgraph Extraction ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    AdjacencyList adjacencyList = readAdjacencyListFromMatrixFile("matrix_input.txt");
+    
+    // Induced subgraph on the even vertices
+    std::vector<int> selectedVertices;
+    for (int vertexIndex = 0; vertexIndex < csrGraph.numberOfVertices; vertexIndex += 2) {
+        selectedVertices.push_back(vertexIndex);
+    }
+    SubgraphVertexMap vertexMap = buildSubgraphVertexMap(selectedVertices, csrGraph.numberOfVertices);
+    CompressedSparseRow inducedCsr = extractInducedSubgraphFromCompressedSparseRow(csrGraph, vertexMap);
+    AdjacencyList inducedList = extractInducedSubgraphFromAdjacencyList(adjacencyList, vertexMap);
+    std::cout << "Subgraph vertex -> original vertex:";
+    for (int newVertex = 0; newVertex < static_cast<int>(vertexMap.originalIdOfVertex.size()); ++newVertex) {
+        std::cout << " " << newVertex << "->" << vertexMap.originalIdOfVertex[newVertex];
+    }
+    std::cout << std::endl;
+    displayCompressedSparseRow(inducedCsr);
+    
+    bool representationsAgree = inducedList.numberOfVertices == inducedCsr.numberOfVertices;
+    for (int newVertex = 0; representationsAgree && newVertex < inducedCsr.numberOfVertices; ++newVertex) {
+        std::vector<int> csrRow(inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex],
+                                inducedCsr.columnIndices.begin() + inducedCsr.rowOffsets[newVertex + 1]);
+        representationsAgree = csrRow == inducedList.adjacencyData[newVertex];
+    }
+    std::cout << "CSR and adjacency list extraction agree: " << (representationsAgree ? "yes" : "no") << std::endl;
+    
+    // Edge filter keeping only edges that point to a higher vertex id
+    auto pointsUpward = [](int sourceVertex, int targetVertex) { return sourceVertex < targetVertex; };
+    CompressedSparseRow upwardCsr = filterCompressedSparseRowEdges(csrGraph, pointsUpward);
+    AdjacencyList upwardList = filterAdjacencyListEdges(adjacencyList, pointsUpward);
+    int upwardListEdges = 0;
+    for (const std::vector<int>& neighbors : upwardList.adjacencyData) {
+        upwardListEdges += static_cast<int>(neighbors.size());
+    }
+    std::cout << "Upward edges kept: " << upwardCsr.numberOfEdges << " of " << csrGraph.numberOfEdges
+              << " (adjacency list: " << upwardListEdges << ")" << std::endl;
+}
+
+/**
+ * @brief Test pull-based PageRank, personalized PageRank and Katz centrality using input.txt
+ */
+void testSimpleGraphLinkAnalysis() {
+    std::cout << "\n=== Testing Link Analysis ===" << std::endl;
+    
+    ExtendedAdjacencyList extendedList = readExtendedAdjacencyListFromEdgeList("input.txt");
+    BlockedCompressedSparseColumn pullGraph = buildBlockedCompressedSparseColumn(extendedList);
+    
+    LinkAnalysisResult pageRank = computePageRank(pullGraph);
+    displayLinkAnalysisResult(pageRank, "PageRank");
+    double scoreTotal = 0.0;
+    for (double vertexScore : pageRank.vertexScores) {
+        scoreTotal += vertexScore;
+    }
+    std::cout << "PageRank sums to 1: " << (std::fabs(scoreTotal - 1.0) < 1e-9 ? "yes" : "no") << std::endl;
+    
+    // Splitting sources into blocks of two vertices must not change the result
+    LinkAnalysisResult blockedPageRank = computePageRank(buildBlockedCompressedSparseColumn(extendedList, 2));
+    double largestDifference = 0.0;
+    for (int vertexIndex = 0; vertexIndex < static_cast<int>(pageRank.vertexScores.size()); ++vertexIndex) {
+        largestDifference = std::max(largestDifference, std::fabs(pageRank.vertexScores[vertexIndex] - blockedPageRank.vertexScores[vertexIndex]));
+    }
+    std::cout << "Blocks of 2 sources give the same PageRank: " << (largestDifference < 1e-12 ? "yes" : "no") << std::endl;
+    
+    displayLinkAnalysisResult(computePersonalizedPageRank(pullGraph, {0}), "Personalized PageRank from vertex 0");
+    displayLinkAnalysisResult(computeKatzCentrality(pullGraph, 0.1), "Katz centrality (alpha 0.1)");
+}
+
+/**
+ * @brief Test bucket-queue and parallel k-core decomposition using input.txt and a generated graph
+ */
+void testSimpleGraphCoreDecomposition() {
+    std::cout << "\n=== Testing Core Decomposition ===" << std::endl;
+    
+    AdjacencyList adjacencyList = readAdjacencyListFromEdgeList("input.txt");
+    CompressedSparseRow undirectedGraph = buildUndirectedCompressedSparseRow(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+    CoreDecompositionResult coreResult = computeCoreDecomposition(undirectedGraph);
+    displayCoreDecomposition(coreResult);
+    std::cout << "Core property holds: " << (verifyCoreDecomposition(undirectedGraph, coreResult) ? "yes" : "no") << std::endl;
+    std::cout << "Parallel peeling agrees: "
+              << (computeCoreDecompositionParallel(undirectedGraph).coreNumbers == coreResult.coreNumbers ? "yes" : "no") << std::endl;
+    
+    // Larger generated graph: every vertex links to a few pseudo-random targets, more for low ids
+    const int GENERATED_VERTEX_COUNT = 50000;
+    AdjacencyList generatedList(GENERATED_VERTEX_COUNT);
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        int linkCount = 2 + 200000 / (sourceVertex + 1000);
+        for (int linkIndex = 1; linkIndex <= linkCount; ++linkIndex) {
+            int targetVertex = static_cast<int>((sourceVertex * 7919LL + linkIndex * 104729LL) % GENERATED_VERTEX_COUNT);
+            if (targetVertex != sourceVertex) {
+                generatedList.adjacencyData[sourceVertex].push_back(targetVertex);
+            }
+        }
+    }
+    CompressedSparseRow generatedGraph = buildUndirectedCompressedSparseRow(generatedList.adjacencyData, generatedList.numberOfVertices);
+    CoreDecompositionResult generatedCores = computeCoreDecomposition(generatedGraph);
+    std::cout << "Generated graph: " << generatedGraph.numberOfVertices << " vertices, " << generatedGraph.numberOfEdges
+              << " undirected edges, degeneracy " << generatedCores.degeneracy << ", core property holds: "
+              << (verifyCoreDecomposition(generatedGraph, generatedCores) ? "yes" : "no") << ", parallel peeling agrees: "
+              << (computeCoreDecompositionParallel(generatedGraph).coreNumbers == generatedCores.coreNumbers ? "yes" : "no") << std::endl;
+}
+
+/**
+ * @brief Test the pipelined parse, validate, dedupe and build ingest against the sequential reader
+ */
+void testSimpleGraphPipelinedIngest() {
+    std::cout << "\n=== Testing Pipelined Ingest ===" << std::endl;
+    
+    IngestOptions ingestOptions;
+    IngestReport ingestReport;
+    AdjacencyList pipelinedList = readAdjacencyListFromEdgeListPipelined("input.txt", ingestOptions, ingestReport);
+    displayIngestReport(ingestReport);
+    AdjacencyList sequentialList = readAdjacencyListFromEdgeList("input.txt");
+    std::cout << "Matches sequential reader: " << (pipelinedList.adjacencyData == sequentialList.adjacencyData ? "yes" : "no") << std::endl;
+    
+    // Larger generated edge list, ten distinct non-loop targets per vertex
+    const int GENERATED_VERTEX_COUNT = 200000;
+    const int TARGETS_PER_VERTEX = 10;
+    const std::string GENERATED_GRAPH_FILE = "ingest_generated.txt";
+    std::ofstream generatedFile(GENERATED_GRAPH_FILE);
+    generatedFile << GENERATED_VERTEX_COUNT << " " << static_cast<long long>(GENERATED_VERTEX_COUNT) * TARGETS_PER_VERTEX << "\n";
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        for (int targetIndex = 0; targetIndex < TARGETS_PER_VERTEX; ++targetIndex) {
+            generatedFile << sourceVertex << " " << (sourceVertex + 1 + targetIndex * 7919) % GENERATED_VERTEX_COUNT << "\n";
+        }
+    }
+    generatedFile.close();
+    
+    auto startTime = std::chrono::steady_clock::now();
+    sequentialList = readAdjacencyListFromEdgeList(GENERATED_GRAPH_FILE);
+    double sequentialSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    pipelinedList = readAdjacencyListFromEdgeListPipelined(GENERATED_GRAPH_FILE, ingestOptions, ingestReport);
+    std::cout << "Sequential reader: " << sequentialSeconds << " s" << std::endl;
+    displayIngestReport(ingestReport);
+    std::cout << "Matches sequential reader: " << (pipelinedList.adjacencyData == sequentialList.adjacencyData ? "yes" : "no") << std::endl;
+    std::remove(GENERATED_GRAPH_FILE.c_str());
+}
+
+/**
+ * @brief Test all-pairs reachability by bit-row Warshall and by component condensation
+ */
+void testSimpleGraphTransitiveClosure() {
+    std::cout << "\n=== Testing Transitive Closure ===" << std::endl;
+    
+    CompressedSparseRow csrGraph = readCompressedSparseRowFromMatrixFile("matrix_input.txt");
+    ReachabilityIndex warshallIndex = computeTransitiveClosureWarshall(csrGraph);
+    ReachabilityIndex condensedIndex = computeTransitiveClosureByCondensation(csrGraph);
+    displayReachabilityMatrix(condensedIndex);
+    std::cout << "Warshall and condensation agree: " << (areReachabilityIndexesEqual(warshallIndex, condensedIndex) ? "yes" : "no") << std::endl;
+    
+    // Generated graph: mostly forward edges with a few backward ones, so there are both cycles and long chains
+    const int GENERATED_VERTEX_COUNT = 20000;
+    std::vector<std::vector<int>> generatedTargets(GENERATED_VERTEX_COUNT);
+    unsigned int randomState = 75;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; ++sourceVertex) {
+        for (int linkIndex = 0; linkIndex < 2; ++linkIndex) {
+            randomState = randomState * 1103515245u + 12345u;
+            int targetVertex = sourceVertex + 1 + static_cast<int>((randomState >> 8) % 64);
+            if (linkIndex == 1 && (randomState >> 20) % 50 == 0) {
+                targetVertex = sourceVertex - 1 - static_cast<int>((randomState >> 8) % 200);
+            }
+            if (targetVertex >= 0 && targetVertex < GENERATED_VERTEX_COUNT) {
+                generatedTargets[sourceVertex].push_back(targetVertex);
+            }
+        }
+    }
+    CompressedSparseRow generatedGraph;
+    generatedGraph.numberOfVertices = GENERATED_VERTEX_COUNT;
+    generatedGraph.rowOffsets.assign(1, 0);
+    for (const std::vector<int>& targetList : generatedTargets) {
+        generatedGraph.columnIndices.insert(generatedGraph.columnIndices.end(), targetList.begin(), targetList.end());
+        generatedGraph.rowOffsets.push_back(static_cast<int>(generatedGraph.columnIndices.size()));
+    }
+    generatedGraph.numberOfEdges = static_cast<int>(generatedGraph.columnIndices.size());
+    
+    auto startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex generatedIndex = computeReachabilityIndex(generatedGraph);
+    double condensationSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    std::vector<int> sampleSources;
+    for (int sourceVertex = 0; sourceVertex < GENERATED_VERTEX_COUNT; sourceVertex += 997) {
+        sampleSources.push_back(sourceVertex);
+    }
+    std::cout << "Generated graph: " << generatedGraph.numberOfVertices << " vertices, " << generatedGraph.numberOfEdges << " edges, "
+              << generatedIndex.numberOfComponents << " components, " << countReachablePairs(generatedIndex)
+              << " reachable pairs, closure in " << condensationSeconds << " s" << std::endl;
+    std::cout << "Sampled rows match BFS: " << (verifyReachabilityIndex(generatedGraph, generatedIndex, sampleSources) ? "yes" : "no") << std::endl;
+    std::cout << "Vertex 0 reaches vertex " << GENERATED_VERTEX_COUNT - 1 << ": "
+              << (canReach(generatedIndex, 0, GENERATED_VERTEX_COUNT - 1) ? "yes" : "no") << std::endl;
+    
+    // Warshall on the first 2000 vertices must agree with the condensation
+    SubgraphVertexMap prefixMap = buildSubgraphVertexMapFromPredicate(GENERATED_VERTEX_COUNT, [](int vertexIndex) { return vertexIndex < 2000; });
+    CompressedSparseRow prefixGraph = extractInducedSubgraphFromCompressedSparseRow(generatedGraph, prefixMap);
+    startTime = std::chrono::steady_clock::now();
+    ReachabilityIndex prefixWarshall = computeTransitiveClosureWarshall(prefixGraph);
+    double warshallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    ReachabilityIndex prefixCondensed = computeTransitiveClosureByCondensation(prefixGraph);
+    std::cout << "First 2000 vertices: Warshall in " << warshallSeconds << " s, agrees with condensation: "
+              << (areReachabilityIndexesEqual(prefixWarshall, prefixCondensed) ? "yes" : "no") << std::endl;
+}
+
 /**
  * @brief Main program entry point
  * @return Program exit status
@@ -174,6 +632,19 @@ int main() {
     try {
         demonstrateSimpleGraphRepresentationConversions();
         testSimpleGraphMatrixInputFormat();
+        testSimpleGraphSparseMatrixReader();
+        testSimpleGraphTriangleCounting();
+        testSimpleGraphGapEncodedAdjacency();
+        testSimpleGraphNeighborhoodSimilarity();
+        testSimpleGraphNeighborViews();
+        testSimpleGraphConsumingConversions();
+        testSimpleGraphSummaryDisplay();
+        testSimpleGraphFingerprints();
+        testSimpleGraphSubgraphExtraction();
+        testSimpleGraphLinkAnalysis();
+        testSimpleGraphCoreDecomposition();
+        testSimpleGraphPipelinedIngest();
+        testSimpleGraphTransitiveClosure();
         
         std::cout << "=== SimpleGraph Representation Demo Completed Successfully ===" << std::endl;
         
@@ -0,0 +1,370 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <map>
+#include <queue>
+#include <type_traits>
+#include <utility>
+
+/**
+ * @brief Non-owning views that present any representation as out-neighbor lists without copying
+ * @details Every view models the NeighborView interface:
+ *          - int vertexCount() const
+ *          - int outDegree(int vertex) const
+ *          - bool hasEdge(int sourceVertex, int targetVertex) const
+ *          - template <typename F> void forEachNeighbor(int vertex, F visitNeighbor) const
+ *          Views hold references, so the viewed representation must outlive the view.
+ */
+
+/**
+ * @brief Callable used only to probe forEachNeighbor in the detection trait below
+ */
+struct NeighborViewProbeVisitor {
+    void operator()(int) const {}
+};
+
+/**
+ * @brief Detect whether a type models the NeighborView interface
+ */
+template <typename ViewType, typename = void>
+struct isNeighborView : std::false_type {};
+
+template <typename ViewType>
+struct isNeighborView<ViewType, std::void_t<
+    decltype(std::declval<const ViewType&>().vertexCount()),
+    decltype(std::declval<const ViewType&>().outDegree(0)),
+    decltype(std::declval<const ViewType&>().hasEdge(0, 0)),
+    decltype(std::declval<const ViewType&>().forEachNeighbor(0, NeighborViewProbeVisitor()))>> : std::true_type {};
+
+/**
+ * @brief View over adjacency list data
+ */
+struct AdjacencyListNeighborView {
+    const std::vector<std::vector<int>>& adjacencyData;
+
+    int vertexCount() const {
+        return static_cast<int>(adjacencyData.size());
+    }
+
+    int outDegree(int vertex) const {
+        return static_cast<int>(adjacencyData[vertex].size());
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        for (int neighborVertex : adjacencyData[sourceVertex]) {
+            if (neighborVertex == targetVertex) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        for (int neighborVertex : adjacencyData[vertex]) {
+            visitNeighbor(neighborVertex);
+        }
+    }
+};
+
+/**
+ * @brief View of an adjacency matrix as neighbor lists, a row scan per vertex and O(1) edge probes
+ */
+struct AdjacencyMatrixNeighborView {
+    const std::vector<std::vector<int>>& matrixData;
+    int numberOfVertices;
+
+    int vertexCount() const {
+        return numberOfVertices;
+    }
+
+    int outDegree(int vertex) const {
+        int degreeCount = 0;
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            degreeCount += matrixData[vertex][targetVertex] > 0;
+        }
+        return degreeCount;
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        return matrixData[sourceVertex][targetVertex] > 0;
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        for (int targetVertex = 0; targetVertex < numberOfVertices; ++targetVertex) {
+            if (matrixData[vertex][targetVertex] > 0) {
+                visitNeighbor(targetVertex);
+            }
+        }
+    }
+};
+
+/**
+ * @brief View of an extended adjacency list as plain neighbor lists, resolving edge indices on the fly
+ */
+struct ExtendedListNeighborView {
+    const std::vector<std::pair<int, int>>& edgeInstances;
+    const std::vector<std::vector<int>>& outgoingEdgeIndices;
+
+    int vertexCount() const {
+        return static_cast<int>(outgoingEdgeIndices.size());
+    }
+
+    int outDegree(int vertex) const {
+        return static_cast<int>(outgoingEdgeIndices[vertex].size());
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        for (int edgeIndex : outgoingEdgeIndices[sourceVertex]) {
+            if (edgeInstances[edgeIndex].second == targetVertex) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        for (int edgeIndex : outgoingEdgeIndices[vertex]) {
+            visitNeighbor(edgeInstances[edgeIndex].second);
+        }
+    }
+};
+
+/**
+ * @brief View of an adjacency map as neighbor lists, one map lookup per vertex
+ */
+struct AdjacencyMapNeighborView {
+    const std::map<int, std::vector<std::pair<int, std::pair<int, int>>>>& outgoingConnections;
+    int numberOfVertices;
+
+    int vertexCount() const {
+        return numberOfVertices;
+    }
+
+    int outDegree(int vertex) const {
+        auto connectionsIterator = outgoingConnections.find(vertex);
+        return connectionsIterator == outgoingConnections.end() ? 0 : static_cast<int>(connectionsIterator->second.size());
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        bool edgeFound = false;
+        forEachNeighbor(sourceVertex, [&](int neighborVertex) {
+            edgeFound = edgeFound || neighborVertex == targetVertex;
+        });
+        return edgeFound;
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        auto connectionsIterator = outgoingConnections.find(vertex);
+        if (connectionsIterator == outgoingConnections.end()) {
+            return;
+        }
+        for (const auto& connection : connectionsIterator->second) {
+            visitNeighbor(connection.first);
+        }
+    }
+};
+
+/**
+ * @brief View over a CSR layout
+ */
+struct CompressedSparseRowNeighborView {
+    const CompressedSparseRow& csrGraph;
+
+    int vertexCount() const {
+        return csrGraph.numberOfVertices;
+    }
+
+    int outDegree(int vertex) const {
+        return csrGraph.rowOffsets[vertex + 1] - csrGraph.rowOffsets[vertex];
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        for (int position = csrGraph.rowOffsets[sourceVertex]; position < csrGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            if (csrGraph.columnIndices[position] == targetVertex) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        for (int position = csrGraph.rowOffsets[vertex]; position < csrGraph.rowOffsets[vertex + 1]; ++position) {
+            visitNeighbor(csrGraph.columnIndices[position]);
+        }
+    }
+};
+
+/**
+ * @brief View over gap-encoded adjacency, decoding on every pass
+ */
+struct GapEncodedNeighborView {
+    const GapEncodedAdjacency& gapAdjacency;
+
+    int vertexCount() const {
+        return gapAdjacency.numberOfVertices;
+    }
+
+    int outDegree(int vertex) const {
+        int degreeCount = 0;
+        forEachGapEncodedNeighbor(gapAdjacency, vertex, [&](int) {
+            degreeCount++;
+        });
+        return degreeCount;
+    }
+
+    bool hasEdge(int sourceVertex, int targetVertex) const {
+        return hasGapEncodedEdge(gapAdjacency, sourceVertex, targetVertex);
+    }
+
+    template <typename NeighborVisitor>
+    void forEachNeighbor(int vertex, NeighborVisitor visitNeighbor) const {
+        forEachGapEncodedNeighbor(gapAdjacency, vertex, visitNeighbor);
+    }
+};
+
+/**
+ * @brief Create a view over an adjacency list
+ * @param adjacencyList Adjacency list to view
+ * @return Non-owning view
+ */
+AdjacencyListNeighborView viewNeighbors(const AdjacencyList& adjacencyList) {
+    return {adjacencyList.adjacencyData};
+}
+
+/**
+ * @brief Create a neighbor-list view over an adjacency matrix
+ * @param adjacencyMatrix Adjacency matrix to view
+ * @return Non-owning view
+ */
+AdjacencyMatrixNeighborView viewNeighbors(const AdjacencyMatrix& adjacencyMatrix) {
+    return {adjacencyMatrix.matrixData, adjacencyMatrix.numberOfVertices};
+}
+
+/**
+ * @brief Create a neighbor-list view over an extended adjacency list
+ * @param extendedList Extended adjacency list to view
+ * @return Non-owning view
+ */
+ExtendedListNeighborView viewNeighbors(const ExtendedAdjacencyList& extendedList) {
+    return {extendedList.edgeInstances, extendedList.outgoingEdgeIndices};
+}
+
+/**
+ * @brief Create a neighbor-list view over an adjacency map
+ * @param adjacencyMap Adjacency map to view
+ * @return Non-owning view
+ */
+AdjacencyMapNeighborView viewNeighbors(const AdjacencyMap& adjacencyMap) {
+    return {adjacencyMap.outgoingConnections, adjacencyMap.numberOfVertices};
+}
+
+/**
+ * @brief Create a view over a CSR layout
+ * @param csrGraph CSR structure to view
+ * @return Non-owning view
+ */
+CompressedSparseRowNeighborView viewNeighbors(const CompressedSparseRow& csrGraph) {
+    return {csrGraph};
+}
+
+/**
+ * @brief Create a view over gap-encoded adjacency
+ * @param gapAdjacency Gap-encoded adjacency to view
+ * @return Non-owning view
+ */
+GapEncodedNeighborView viewNeighbors(const GapEncodedAdjacency& gapAdjacency) {
+    return {gapAdjacency};
+}
+
+/**
+ * @brief Count edges seen through any neighbor view
+ * @param neighborView View modelling NeighborView
+ * @return Number of edges
+ */
+template <typename NeighborView>
+long long countNeighborViewEdges(const NeighborView& neighborView) {
+    static_assert(isNeighborView<NeighborView>::value, "countNeighborViewEdges requires a NeighborView");
+    long long edgeCount = 0;
+    for (int vertexIndex = 0; vertexIndex < neighborView.vertexCount(); ++vertexIndex) {
+        edgeCount += neighborView.outDegree(vertexIndex);
+    }
+    return edgeCount;
+}
+
+/**
+ * @brief Breadth-first visiting order from a start vertex through any neighbor view
+ * @param neighborView View modelling NeighborView
+ * @param startVertex Vertex to start from
+ * @return Vertices in the order they are first reached
+ */
+template <typename NeighborView>
+std::vector<int> computeBreadthFirstOrderOverView(const NeighborView& neighborView, int startVertex) {
+    static_assert(isNeighborView<NeighborView>::value, "computeBreadthFirstOrderOverView requires a NeighborView");
+    std::vector<int> visitOrder;
+    if (startVertex < 0 || startVertex >= neighborView.vertexCount()) {
+        return visitOrder;
+    }
+
+    std::vector<bool> isVisited(neighborView.vertexCount(), false);
+    std::queue<int> vertexQueue;
+    isVisited[startVertex] = true;
+    vertexQueue.push(startVertex);
+    while (!vertexQueue.empty()) {
+        int currentVertex = vertexQueue.front();
+        vertexQueue.pop();
+        visitOrder.push_back(currentVertex);
+        neighborView.forEachNeighbor(currentVertex, [&](int neighborVertex) {
+            if (!isVisited[neighborVertex]) {
+                isVisited[neighborVertex] = true;
+                vertexQueue.push(neighborVertex);
+            }
+        });
+    }
+    return visitOrder;
+}
+
+/**
+ * @brief Copy a view into an owning adjacency list, for when a materialized representation is really needed
+ * @param neighborView View modelling NeighborView
+ * @return AdjacencyList holding the viewed neighbors
+ */
+template <typename NeighborView>
+AdjacencyList materializeNeighborViewAsAdjacencyList(const NeighborView& neighborView) {
+    static_assert(isNeighborView<NeighborView>::value, "materializeNeighborViewAsAdjacencyList requires a NeighborView");
+    AdjacencyList adjacencyList(neighborView.vertexCount());
+    for (int vertexIndex = 0; vertexIndex < neighborView.vertexCount(); ++vertexIndex) {
+        adjacencyList.adjacencyData[vertexIndex].reserve(neighborView.outDegree(vertexIndex));
+        neighborView.forEachNeighbor(vertexIndex, [&](int neighborVertex) {
+            adjacencyList.adjacencyData[vertexIndex].push_back(neighborVertex);
+        });
+    }
+    return adjacencyList;
+}
+
+/**
+ * @brief Display any neighbor view to console in adjacency list layout
+ * @param neighborView View modelling NeighborView
+ * @param viewTitle Name printed in the header
+ */
+template <typename NeighborView>
+void displayNeighborView(const NeighborView& neighborView, const std::string& viewTitle) {
+    static_assert(isNeighborView<NeighborView>::value, "displayNeighborView requires a NeighborView");
+    std::cout << "=== " << viewTitle << " (view) ===" << std::endl;
+    std::cout << "Number of vertices: " << neighborView.vertexCount() << std::endl;
+    for (int vertexIndex = 0; vertexIndex < neighborView.vertexCount(); ++vertexIndex) {
+        std::cout << "Vertex " << vertexIndex << ":";
+        if (neighborView.outDegree(vertexIndex) == 0) {
+            std::cout << " (no outgoing edges)";
+        }
+        neighborView.forEachNeighbor(vertexIndex, [&](int neighborVertex) {
+            std::cout << " " << neighborVertex;
+        });
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
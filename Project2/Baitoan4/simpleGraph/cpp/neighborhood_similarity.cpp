@@ -0,0 +1,252 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <algorithm>
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+/**
+ * @brief Size ratio above which the shorter list gallops through the longer one instead of merging
+ */
+const int GALLOPING_SIZE_RATIO = 32;
+
+/**
+ * @brief Answer of one common-neighbor / Jaccard query
+ */
+struct NeighborhoodSimilarity {
+    int commonNeighborCount;
+    double jaccardSimilarity;
+};
+
+/**
+ * @brief Count common elements of two strictly increasing ranges by linear merge
+ * @param leftBegin Start of the first range
+ * @param leftEnd End of the first range
+ * @param rightBegin Start of the second range
+ * @param rightEnd End of the second range
+ * @return Number of common elements
+ */
+int countSortedIntersectionScalar(const int* leftBegin, const int* leftEnd, const int* rightBegin, const int* rightEnd) {
+    int commonCount = 0;
+    while (leftBegin < leftEnd && rightBegin < rightEnd) {
+        if (*leftBegin < *rightBegin) {
+            leftBegin++;
+        } else if (*rightBegin < *leftBegin) {
+            rightBegin++;
+        } else {
+            commonCount++;
+            leftBegin++;
+            rightBegin++;
+        }
+    }
+    return commonCount;
+}
+
+/**
+ * @brief Count common elements of two strictly increasing ranges, comparing blocks of 4 x 4 with SSE2
+ * @details Each block compares all 16 pairs with four rotated equality tests, then the block with the
+ *          smaller last element is retired. Falls back to the scalar merge for the tails and without SSE2.
+ * @param leftBegin Start of the first range
+ * @param leftEnd End of the first range
+ * @param rightBegin Start of the second range
+ * @param rightEnd End of the second range
+ * @return Number of common elements
+ */
+int countSortedIntersectionMerge(const int* leftBegin, const int* leftEnd, const int* rightBegin, const int* rightEnd) {
+    int commonCount = 0;
+#if defined(__SSE2__)
+    while (leftEnd - leftBegin >= 4 && rightEnd - rightBegin >= 4) {
+        __m128i leftBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(leftBegin));
+        __m128i rightBlock = _mm_loadu_si128(reinterpret_cast<const __m128i*>(rightBegin));
+        __m128i matchMask = _mm_cmpeq_epi32(leftBlock, rightBlock);
+        matchMask = _mm_or_si128(matchMask, _mm_cmpeq_epi32(leftBlock, _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(0, 3, 2, 1))));
+        matchMask = _mm_or_si128(matchMask, _mm_cmpeq_epi32(leftBlock, _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(1, 0, 3, 2))));
+        matchMask = _mm_or_si128(matchMask, _mm_cmpeq_epi32(leftBlock, _mm_shuffle_epi32(rightBlock, _MM_SHUFFLE(2, 1, 0, 3))));
+        commonCount += __builtin_popcount(_mm_movemask_ps(_mm_castsi128_ps(matchMask)));
+
+        int leftLast = leftBegin[3];
+        int rightLast = rightBegin[3];
+        if (leftLast <= rightLast) {
+            leftBegin += 4;
+        }
+        if (rightLast <= leftLast) {
+            rightBegin += 4;
+        }
+    }
+#endif
+    return commonCount + countSortedIntersectionScalar(leftBegin, leftEnd, rightBegin, rightEnd);
+}
+
+/**
+ * @brief Count common elements by galloping each element of the short range through the long one
+ * @param shortBegin Start of the shorter range
+ * @param shortEnd End of the shorter range
+ * @param longBegin Start of the longer range
+ * @param longEnd End of the longer range
+ * @return Number of common elements
+ */
+int countSortedIntersectionGalloping(const int* shortBegin, const int* shortEnd, const int* longBegin, const int* longEnd) {
+    int commonCount = 0;
+    for (; shortBegin < shortEnd && longBegin < longEnd; ++shortBegin) {
+        int targetValue = *shortBegin;
+        // Double the step until the target is bracketed, then binary search the bracket
+        std::ptrdiff_t stepSize = 1;
+        const int* probePosition = longBegin;
+        while (probePosition + stepSize < longEnd && probePosition[stepSize] < targetValue) {
+            probePosition += stepSize;
+            stepSize <<= 1;
+        }
+        longBegin = std::lower_bound(probePosition, std::min(longEnd, probePosition + stepSize + 1), targetValue);
+        if (longBegin < longEnd && *longBegin == targetValue) {
+            commonCount++;
+            longBegin++;
+        }
+    }
+    return commonCount;
+}
+
+/**
+ * @brief Count common elements of two sorted neighbor lists, choosing merge or galloping by size ratio
+ * @param leftBegin Start of the first range
+ * @param leftEnd End of the first range
+ * @param rightBegin Start of the second range
+ * @param rightEnd End of the second range
+ * @return Number of common elements
+ */
+int countSortedIntersection(const int* leftBegin, const int* leftEnd, const int* rightBegin, const int* rightEnd) {
+    std::ptrdiff_t leftSize = leftEnd - leftBegin;
+    std::ptrdiff_t rightSize = rightEnd - rightBegin;
+    if (leftSize > rightSize) {
+        std::swap(leftBegin, rightBegin);
+        std::swap(leftEnd, rightEnd);
+        std::swap(leftSize, rightSize);
+    }
+    if (leftSize == 0) {
+        return 0;
+    }
+    if (rightSize / leftSize >= GALLOPING_SIZE_RATIO) {
+        return countSortedIntersectionGalloping(leftBegin, leftEnd, rightBegin, rightEnd);
+    }
+    return countSortedIntersectionMerge(leftBegin, leftEnd, rightBegin, rightEnd);
+}
+
+/**
+ * @brief Build a CSR with sorted neighbor lists for similarity queries
+ * @param adjacencyList Simple graph adjacency list
+ * @param useUndirectedNeighborhoods Merge in- and out-neighbors instead of using out-neighbors only
+ * @return CompressedSparseRow whose rows are strictly increasing
+ */
+CompressedSparseRow buildNeighborhoodIndex(const AdjacencyList& adjacencyList, bool useUndirectedNeighborhoods = false) {
+    if (useUndirectedNeighborhoods) {
+        return buildUndirectedCompressedSparseRow(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+    }
+
+    CompressedSparseRow neighborhoodIndex(adjacencyList.numberOfVertices);
+    for (int sourceVertex = 0; sourceVertex < adjacencyList.numberOfVertices; ++sourceVertex) {
+        std::size_t rowBegin = neighborhoodIndex.columnIndices.size();
+        neighborhoodIndex.columnIndices.insert(neighborhoodIndex.columnIndices.end(),
+                                               adjacencyList.adjacencyData[sourceVertex].begin(),
+                                               adjacencyList.adjacencyData[sourceVertex].end());
+        std::sort(neighborhoodIndex.columnIndices.begin() + rowBegin, neighborhoodIndex.columnIndices.end());
+        neighborhoodIndex.rowOffsets.push_back(static_cast<int>(neighborhoodIndex.columnIndices.size()));
+    }
+    neighborhoodIndex.numberOfEdges = static_cast<int>(neighborhoodIndex.columnIndices.size());
+    return neighborhoodIndex;
+}
+
+/**
+ * @brief Compute common-neighbor count and Jaccard similarity of two vertices
+ * @param neighborhoodIndex CSR with sorted rows
+ * @param firstVertex First vertex
+ * @param secondVertex Second vertex
+ * @return NeighborhoodSimilarity, with count -1 when a vertex is out of range
+ */
+NeighborhoodSimilarity computeNeighborhoodSimilarity(const CompressedSparseRow& neighborhoodIndex, int firstVertex, int secondVertex) {
+    if (firstVertex < 0 || firstVertex >= neighborhoodIndex.numberOfVertices ||
+        secondVertex < 0 || secondVertex >= neighborhoodIndex.numberOfVertices) {
+        return {-1, 0.0};
+    }
+    const int* columnData = neighborhoodIndex.columnIndices.data();
+    const int* firstBegin = columnData + neighborhoodIndex.rowOffsets[firstVertex];
+    const int* firstEnd = columnData + neighborhoodIndex.rowOffsets[firstVertex + 1];
+    const int* secondBegin = columnData + neighborhoodIndex.rowOffsets[secondVertex];
+    const int* secondEnd = columnData + neighborhoodIndex.rowOffsets[secondVertex + 1];
+
+    int commonCount = countSortedIntersection(firstBegin, firstEnd, secondBegin, secondEnd);
+    long long unionSize = (firstEnd - firstBegin) + (secondEnd - secondBegin) - commonCount;
+    return {commonCount, unionSize > 0 ? static_cast<double>(commonCount) / unionSize : 0.0};
+}
+
+/**
+ * @brief Read vertex pair queries from file
+ * @details Format: first line is the number of queries, then one "u v" pair per line
+ * @param fileName Name of query file
+ * @return Vertex pairs in file order
+ */
+std::vector<std::pair<int, int>> readVertexPairQueriesFromFile(const std::string& fileName) {
+    std::vector<std::pair<int, int>> queryPairs;
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return queryPairs;
+    }
+
+    int numberOfQueries;
+    inputFile >> numberOfQueries;
+    queryPairs.resize(numberOfQueries);
+    for (int queryIndex = 0; queryIndex < numberOfQueries; ++queryIndex) {
+        inputFile >> queryPairs[queryIndex].first >> queryPairs[queryIndex].second;
+    }
+
+    inputFile.close();
+    return queryPairs;
+}
+
+/**
+ * @brief Answer a batch of similarity queries in parallel
+ * @param neighborhoodIndex CSR with sorted rows
+ * @param queryPairs Vertex pairs to query
+ * @return Similarity for every query, in input order
+ */
+std::vector<NeighborhoodSimilarity> answerNeighborhoodSimilarityQueries(const CompressedSparseRow& neighborhoodIndex,
+                                                                       const std::vector<std::pair<int, int>>& queryPairs) {
+    std::vector<NeighborhoodSimilarity> queryAnswers(queryPairs.size());
+    runParallelForRange(static_cast<int>(queryPairs.size()), [&](int rangeBegin, int rangeEnd) {
+        for (int queryIndex = rangeBegin; queryIndex < rangeEnd; ++queryIndex) {
+            queryAnswers[queryIndex] = computeNeighborhoodSimilarity(neighborhoodIndex, queryPairs[queryIndex].first,
+                                                                     queryPairs[queryIndex].second);
+        }
+    });
+    return queryAnswers;
+}
+
+/**
+ * @brief Write similarity answers to file, one "u v common jaccard" line per query
+ * @param queryPairs Vertex pairs that were queried
+ * @param queryAnswers Answers in the same order
+ * @param fileName Name of output file
+ */
+void writeNeighborhoodSimilarityAnswersToFile(const std::vector<std::pair<int, int>>& queryPairs,
+                                              const std::vector<NeighborhoodSimilarity>& queryAnswers,
+                                              const std::string& fileName) {
+    std::ofstream outputFile(fileName);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return;
+    }
+
+    for (std::size_t queryIndex = 0; queryIndex < queryPairs.size(); ++queryIndex) {
+        outputFile << queryPairs[queryIndex].first << " " << queryPairs[queryIndex].second << " ";
+        if (queryAnswers[queryIndex].commonNeighborCount < 0) {
+            outputFile << "invalid" << '\n';
+        } else {
+            outputFile << queryAnswers[queryIndex].commonNeighborCount << " "
+                       << queryAnswers[queryIndex].jaccardSimilarity << '\n';
+        }
+    }
+
+    outputFile.flush();
+    outputFile.close();
+}
@@ -0,0 +1,409 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <atomic>
+#include <algorithm>
+#include <thread>
+#include <chrono>
+#include <cstdint>
+#include <utility>
+#include <unordered_set>
+
+/**
+ * @brief Edges parsed per batch handed between pipeline stages
+ */
+const int INGEST_DEFAULT_BATCH_SIZE = 4096;
+
+/**
+ * @brief Batches buffered between two neighboring stages, a power of two
+ */
+const int INGEST_DEFAULT_QUEUE_CAPACITY = 64;
+
+/**
+ * @brief Bytes read from the input stream per refill of the parser buffer
+ */
+const int INGEST_READ_CHUNK_BYTES = 1 << 20;
+
+/**
+ * @brief Which edges count as repeats of an earlier edge
+ */
+enum class DuplicateEdgePolicy {
+    SameOrderedPair,   // (u,v) repeats only (u,v)
+    SameUnorderedPair  // (u,v) also repeats (v,u)
+};
+
+/**
+ * @brief Settings of the pipelined ingest
+ */
+struct IngestOptions {
+    DuplicateEdgePolicy duplicatePolicy;
+    bool printWarnings;
+    int batchSize;
+    int queueCapacity;
+
+    /**
+     * @brief Default constructor: ordered duplicates, warnings printed like readAdjacencyListFromEdgeList
+     */
+    IngestOptions() : duplicatePolicy(DuplicateEdgePolicy::SameOrderedPair), printWarnings(true),
+                      batchSize(INGEST_DEFAULT_BATCH_SIZE), queueCapacity(INGEST_DEFAULT_QUEUE_CAPACITY) {}
+};
+
+/**
+ * @brief Counters and timing of one pipelined ingest
+ * @details A stall is one wait of a stage on an empty input queue or a full output queue;
+ *          stalls show which stage bounds the throughput
+ */
+struct IngestReport {
+    long long edgesRead;
+    long long selfLoopsRemoved;
+    long long outOfRangeRemoved;
+    long long duplicatesRemoved;
+    long long edgesKept;
+    long long bytesRead;
+    double elapsedSeconds;
+    long long parseStalls;
+    long long validateStalls;
+    long long dedupeStalls;
+    long long buildStalls;
+
+    /**
+     * @brief Default constructor, all counters zero
+     */
+    IngestReport() : edgesRead(0), selfLoopsRemoved(0), outOfRangeRemoved(0), duplicatesRemoved(0), edgesKept(0), bytesRead(0),
+                     elapsedSeconds(0.0), parseStalls(0), validateStalls(0), dedupeStalls(0), buildStalls(0) {}
+};
+
+/**
+ * @brief Bounded lock-free queue between exactly one producer thread and one consumer thread
+ * @details Ring buffer indexed by two monotonically increasing counters; each counter is written by one side
+ *          only, so acquire/release ordering is enough. A waiting side yields its time slice instead of
+ *          spinning, which keeps the pipeline usable when stages share one core.
+ */
+template <typename Item>
+class BoundedSingleProducerQueue {
+public:
+    /**
+     * @brief Constructor with capacity, rounded up to a power of two
+     * @param requestedCapacity Minimum number of buffered items
+     */
+    explicit BoundedSingleProducerQueue(int requestedCapacity) : headIndex(0), tailIndex(0), producerClosed(false) {
+        std::size_t slotCount = 1;
+        while (slotCount < static_cast<std::size_t>(std::max(requestedCapacity, 1))) {
+            slotCount <<= 1;
+        }
+        itemSlots.resize(slotCount);
+        slotMask = slotCount - 1;
+    }
+
+    /**
+     * @brief Append an item, waiting while the queue is full
+     * @param item Item to move into the queue
+     * @return Number of times the producer had to wait
+     */
+    long long push(Item&& item) {
+        long long stallCount = 0;
+        std::size_t tail = tailIndex.load(std::memory_order_relaxed);
+        while (tail - headIndex.load(std::memory_order_acquire) == itemSlots.size()) {
+            stallCount++;
+            std::this_thread::yield();
+        }
+        itemSlots[tail & slotMask] = std::move(item);
+        tailIndex.store(tail + 1, std::memory_order_release);
+        return stallCount;
+    }
+
+    /**
+     * @brief Take the oldest item, waiting while the queue is empty and still open
+     * @param item Receives the item
+     * @param stallCount Incremented once per wait
+     * @return False once the producer closed the queue and every item was taken
+     */
+    bool pop(Item& item, long long& stallCount) {
+        std::size_t head = headIndex.load(std::memory_order_relaxed);
+        while (tailIndex.load(std::memory_order_acquire) == head) {
+            // Re-check after seeing the close flag, the last push may have landed in between
+            if (producerClosed.load(std::memory_order_acquire) && tailIndex.load(std::memory_order_acquire) == head) {
+                return false;
+            }
+            stallCount++;
+            std::this_thread::yield();
+        }
+        item = std::move(itemSlots[head & slotMask]);
+        headIndex.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * @brief Signal that no more items will be pushed
+     */
+    void close() {
+        producerClosed.store(true, std::memory_order_release);
+    }
+
+private:
+    std::vector<Item> itemSlots;
+    std::size_t slotMask;
+    alignas(64) std::atomic<std::size_t> headIndex;
+    alignas(64) std::atomic<std::size_t> tailIndex;
+    std::atomic<bool> producerClosed;
+};
+
+/**
+ * @brief Buffered reader of signed decimal integers from a stream
+ * @details Reads large chunks with istream::read and parses digits directly, which is much cheaper than
+ *          formatted extraction with operator>>
+ */
+class ChunkedIntegerReader {
+public:
+    /**
+     * @brief Constructor over an open stream
+     * @param stream Stream to read, for example an ifstream or std::cin
+     */
+    explicit ChunkedIntegerReader(std::istream& stream) : inputStream(stream), chunkBuffer(INGEST_READ_CHUNK_BYTES),
+                                                          bufferPosition(0), bufferLength(0), totalBytes(0) {}
+
+    /**
+     * @brief Parse the next integer, skipping any separators before it
+     * @param value Receives the integer
+     * @return False at end of input or on a character that cannot start a number
+     */
+    bool readInteger(int& value) {
+        int character = peekCharacter();
+        while (character == ' ' || character == '\n' || character == '\r' || character == '\t') {
+            bufferPosition++;
+            character = peekCharacter();
+        }
+        bool isNegative = character == '-';
+        if (isNegative) {
+            bufferPosition++;
+            character = peekCharacter();
+        }
+        if (character < '0' || character > '9') {
+            return false;
+        }
+        long long parsedValue = 0;
+        while (character >= '0' && character <= '9') {
+            parsedValue = parsedValue * 10 + (character - '0');
+            bufferPosition++;
+            character = peekCharacter();
+        }
+        value = static_cast<int>(isNegative ? -parsedValue : parsedValue);
+        return true;
+    }
+
+    /**
+     * @brief Number of bytes consumed from the stream so far
+     * @return Byte count
+     */
+    long long bytesRead() const {
+        return totalBytes;
+    }
+
+private:
+    std::istream& inputStream;
+    std::vector<char> chunkBuffer;
+    std::size_t bufferPosition;
+    std::size_t bufferLength;
+    long long totalBytes;
+
+    /**
+     * @brief Look at the next character, refilling the buffer when it runs out
+     * @return Next character, or -1 at end of input
+     */
+    int peekCharacter() {
+        if (bufferPosition == bufferLength) {
+            inputStream.read(chunkBuffer.data(), static_cast<std::streamsize>(chunkBuffer.size()));
+            bufferLength = static_cast<std::size_t>(inputStream.gcount());
+            bufferPosition = 0;
+            totalBytes += static_cast<long long>(bufferLength);
+            if (bufferLength == 0) {
+                return -1;
+            }
+        }
+        return static_cast<unsigned char>(chunkBuffer[bufferPosition]);
+    }
+};
+
+/**
+ * @brief Verdict of the validate and dedupe stages on one edge of a batch
+ */
+enum class IngestEdgeStatus : unsigned char {
+    Kept,
+    SelfLoop,
+    OutOfRange,
+    Duplicate
+};
+
+/**
+ * @brief Edges handed between pipeline stages, in input order
+ * @details Stages never drop or reorder edges; they only set the status of rejected ones, so the build stage can
+ *          replay the warnings in input order
+ */
+struct IngestEdgeBatch {
+    std::vector<std::pair<int, int>> edges;
+    std::vector<IngestEdgeStatus> edgeStatus;
+};
+
+/**
+ * @brief Read an edge list through a parse -> validate -> dedupe -> build pipeline
+ * @details Parsing, validation and deduplication run on their own threads and hand batches of edges to the next
+ *          stage through bounded lock-free queues, so reading the input overlaps with the checks and the build,
+ *          which runs on the calling thread. The checking stages only mark rejected edges; the build stage walks
+ *          each batch in input order and prints the warnings itself, so the output, the result and the totals are
+ *          those of readAdjacencyListFromEdgeList and no console I/O happens on the other stages. Self-loops are
+ *          checked before the vertex range, as in that reader.
+ * @param inputStream Stream holding "V E" followed by E edge lines; may be std::cin
+ * @param options Duplicate policy, warnings and batch sizes
+ * @param ingestReport Receives counters, stall counts and elapsed time
+ * @return AdjacencyList structure containing the graph data
+ */
+AdjacencyList ingestAdjacencyListPipelined(std::istream& inputStream, const IngestOptions& options, IngestReport& ingestReport) {
+    auto startTime = std::chrono::steady_clock::now();
+    ingestReport = IngestReport();
+
+    ChunkedIntegerReader integerReader(inputStream);
+    int numberOfVertices = 0;
+    int numberOfEdges = 0;
+    if (!integerReader.readInteger(numberOfVertices) || !integerReader.readInteger(numberOfEdges) || numberOfVertices < 0) {
+        std::cerr << "Error: Invalid edge list header" << std::endl;
+        return AdjacencyList();
+    }
+
+    AdjacencyList adjacencyList(numberOfVertices);
+    BoundedSingleProducerQueue<IngestEdgeBatch> parsedQueue(options.queueCapacity);
+    BoundedSingleProducerQueue<IngestEdgeBatch> validatedQueue(options.queueCapacity);
+    BoundedSingleProducerQueue<IngestEdgeBatch> uniqueQueue(options.queueCapacity);
+
+    std::thread parseThread([&]() {
+        IngestEdgeBatch edgeBatch;
+        edgeBatch.edges.reserve(options.batchSize);
+        for (int edgeIndex = 0; edgeIndex < numberOfEdges; ++edgeIndex) {
+            int sourceVertex, targetVertex;
+            if (!integerReader.readInteger(sourceVertex) || !integerReader.readInteger(targetVertex)) {
+                break;
+            }
+            edgeBatch.edges.push_back({sourceVertex, targetVertex});
+            ingestReport.edgesRead++;
+            if (static_cast<int>(edgeBatch.edges.size()) == options.batchSize) {
+                ingestReport.parseStalls += parsedQueue.push(std::move(edgeBatch));
+                edgeBatch = IngestEdgeBatch();
+                edgeBatch.edges.reserve(options.batchSize);
+            }
+        }
+        if (!edgeBatch.edges.empty()) {
+            ingestReport.parseStalls += parsedQueue.push(std::move(edgeBatch));
+        }
+        ingestReport.bytesRead = integerReader.bytesRead();
+        parsedQueue.close();
+    });
+
+    std::thread validateThread([&]() {
+        IngestEdgeBatch edgeBatch;
+        while (parsedQueue.pop(edgeBatch, ingestReport.validateStalls)) {
+            edgeBatch.edgeStatus.assign(edgeBatch.edges.size(), IngestEdgeStatus::Kept);
+            for (std::size_t edgePosition = 0; edgePosition < edgeBatch.edges.size(); ++edgePosition) {
+                const std::pair<int, int>& edge = edgeBatch.edges[edgePosition];
+                if (edge.first == edge.second) {
+                    edgeBatch.edgeStatus[edgePosition] = IngestEdgeStatus::SelfLoop;
+                    ingestReport.selfLoopsRemoved++;
+                } else if (edge.first < 0 || edge.first >= numberOfVertices || edge.second < 0 || edge.second >= numberOfVertices) {
+                    edgeBatch.edgeStatus[edgePosition] = IngestEdgeStatus::OutOfRange;
+                    ingestReport.outOfRangeRemoved++;
+                }
+            }
+            ingestReport.validateStalls += validatedQueue.push(std::move(edgeBatch));
+            edgeBatch = IngestEdgeBatch();
+        }
+        validatedQueue.close();
+    });
+
+    std::thread dedupeThread([&]() {
+        std::unordered_set<std::uint64_t> seenEdges;
+        seenEdges.reserve(static_cast<std::size_t>(std::max(numberOfEdges, 0)));
+        IngestEdgeBatch edgeBatch;
+        while (validatedQueue.pop(edgeBatch, ingestReport.dedupeStalls)) {
+            for (std::size_t edgePosition = 0; edgePosition < edgeBatch.edges.size(); ++edgePosition) {
+                if (edgeBatch.edgeStatus[edgePosition] != IngestEdgeStatus::Kept) {
+                    continue;
+                }
+                int firstVertex = edgeBatch.edges[edgePosition].first;
+                int secondVertex = edgeBatch.edges[edgePosition].second;
+                if (options.duplicatePolicy == DuplicateEdgePolicy::SameUnorderedPair && firstVertex > secondVertex) {
+                    std::swap(firstVertex, secondVertex);
+                }
+                std::uint64_t edgeKey = (static_cast<std::uint64_t>(static_cast<std::uint32_t>(firstVertex)) << 32) |
+                                        static_cast<std::uint32_t>(secondVertex);
+                if (!seenEdges.insert(edgeKey).second) {
+                    edgeBatch.edgeStatus[edgePosition] = IngestEdgeStatus::Duplicate;
+                    ingestReport.duplicatesRemoved++;
+                }
+            }
+            ingestReport.dedupeStalls += uniqueQueue.push(std::move(edgeBatch));
+            edgeBatch = IngestEdgeBatch();
+        }
+        uniqueQueue.close();
+    });
+
+    IngestEdgeBatch edgeBatch;
+    while (uniqueQueue.pop(edgeBatch, ingestReport.buildStalls)) {
+        for (std::size_t edgePosition = 0; edgePosition < edgeBatch.edges.size(); ++edgePosition) {
+            const std::pair<int, int>& edge = edgeBatch.edges[edgePosition];
+            IngestEdgeStatus edgeStatus = edgeBatch.edgeStatus[edgePosition];
+            if (edgeStatus == IngestEdgeStatus::Kept) {
+                adjacencyList.adjacencyData[edge.first].push_back(edge.second);
+                ingestReport.edgesKept++;
+            } else if (edgeStatus == IngestEdgeStatus::SelfLoop && options.printWarnings) {
+                std::cout << "Warning: Self-loop detected (" << edge.first << "," << edge.second
+                          << ") - Removing as simple graphs do not allow self-loops" << std::endl;
+            } else if (edgeStatus == IngestEdgeStatus::Duplicate && options.printWarnings) {
+                std::cout << "Warning: Duplicate edge detected (" << edge.first << "," << edge.second
+                          << ") - Removing as simple graphs do not allow multiple edges" << std::endl;
+            }
+        }
+    }
+    parseThread.join();
+    validateThread.join();
+    dedupeThread.join();
+
+    if (options.printWarnings && ingestReport.selfLoopsRemoved > 0) {
+        std::cout << "Total self-loops removed: " << ingestReport.selfLoopsRemoved << std::endl;
+    }
+    if (options.printWarnings && ingestReport.duplicatesRemoved > 0) {
+        std::cout << "Total duplicate edges removed: " << ingestReport.duplicatesRemoved << std::endl;
+    }
+    ingestReport.elapsedSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - startTime).count();
+    return adjacencyList;
+}
+
+/**
+ * @brief Read an edge list file through the pipelined ingest
+ * @param fileName Name of input file containing edge list
+ * @param options Duplicate policy, warnings and batch sizes
+ * @param ingestReport Receives counters, stall counts and elapsed time
+ * @return AdjacencyList structure containing the graph data
+ */
+AdjacencyList readAdjacencyListFromEdgeListPipelined(const std::string& fileName, const IngestOptions& options, IngestReport& ingestReport) {
+    std::ifstream inputFile(fileName, std::ios::binary);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        ingestReport = IngestReport();
+        return AdjacencyList();
+    }
+    return ingestAdjacencyListPipelined(inputFile, options, ingestReport);
+}
+
+/**
+ * @brief Print the counters and throughput of an ingest
+ * @param ingestReport Report filled by ingestAdjacencyListPipelined
+ */
+void displayIngestReport(const IngestReport& ingestReport) {
+    double elapsedSeconds = ingestReport.elapsedSeconds > 0.0 ? ingestReport.elapsedSeconds : 1e-9;
+    std::cout << "Ingested " << ingestReport.edgesRead << " edges (" << ingestReport.bytesRead << " bytes) in "
+              << ingestReport.elapsedSeconds << " s: " << static_cast<long long>(ingestReport.edgesRead / elapsedSeconds)
+              << " edges/s, " << ingestReport.bytesRead / elapsedSeconds / (1024.0 * 1024.0) << " MB/s" << std::endl;
+    std::cout << "  Kept " << ingestReport.edgesKept << ", removed " << ingestReport.selfLoopsRemoved << " self-loops, "
+              << ingestReport.duplicatesRemoved << " duplicates, " << ingestReport.outOfRangeRemoved << " out of range" << std::endl;
+    std::cout << "  Stalls: parse " << ingestReport.parseStalls << ", validate " << ingestReport.validateStalls
+              << ", dedupe " << ingestReport.dedupeStalls << ", build " << ingestReport.buildStalls << std::endl;
+}
@@ -0,0 +1,234 @@
+#include <vector>
+#include <cstdint>
+
+/**
+ * @brief One bit per vertex, set for vertices that belong to a subgraph
+ */
+struct VertexMembershipBitmap {
+    std::vector<std::uint64_t> bitWords;
+    int numberOfVertices;
+
+    /**
+     * @brief Default constructor
+     */
+    VertexMembershipBitmap() : numberOfVertices(0) {}
+
+    /**
+     * @brief Constructor with vertex count, all bits clear
+     * @param vertexCount Number of vertices in the graph
+     */
+    VertexMembershipBitmap(int vertexCount) : bitWords((vertexCount + 63) / 64, 0), numberOfVertices(vertexCount) {}
+
+    /**
+     * @brief Test whether a vertex belongs to the set
+     * @param vertexIndex Vertex to test
+     * @return True if the vertex bit is set
+     */
+    bool contains(int vertexIndex) const {
+        return (bitWords[vertexIndex >> 6] >> (vertexIndex & 63)) & 1ULL;
+    }
+
+    /**
+     * @brief Add a vertex to the set
+     * @param vertexIndex Vertex to add
+     */
+    void insert(int vertexIndex) {
+        bitWords[vertexIndex >> 6] |= 1ULL << (vertexIndex & 63);
+    }
+};
+
+/**
+ * @brief Vertex selection of a subgraph together with the relabeling in both directions
+ * @details Selected vertices get new ids 0..k-1 in increasing original id order;
+ *          newIdOfVertex is -1 for vertices outside the subgraph
+ */
+struct SubgraphVertexMap {
+    VertexMembershipBitmap membership;
+    std::vector<int> newIdOfVertex;
+    std::vector<int> originalIdOfVertex;
+};
+
+/**
+ * @brief Number the vertices of a membership bitmap in increasing id order
+ * @details Walks the bitmap a word at a time, so sparse selections cost O(V / 64 + k)
+ *          on top of the O(V) id map
+ * @param membership Bitmap of selected vertices
+ * @return SubgraphVertexMap holding the bitmap and both id maps
+ */
+SubgraphVertexMap buildSubgraphVertexMapFromBitmap(const VertexMembershipBitmap& membership) {
+    SubgraphVertexMap vertexMap;
+    vertexMap.membership = membership;
+    vertexMap.newIdOfVertex.assign(membership.numberOfVertices, -1);
+    for (int wordIndex = 0; wordIndex < static_cast<int>(membership.bitWords.size()); ++wordIndex) {
+        std::uint64_t remainingBits = membership.bitWords[wordIndex];
+        while (remainingBits != 0) {
+            int vertexIndex = wordIndex * 64 + __builtin_ctzll(remainingBits);
+            vertexMap.newIdOfVertex[vertexIndex] = static_cast<int>(vertexMap.originalIdOfVertex.size());
+            vertexMap.originalIdOfVertex.push_back(vertexIndex);
+            remainingBits &= remainingBits - 1;
+        }
+    }
+    return vertexMap;
+}
+
+/**
+ * @brief Build the vertex map of the subgraph induced by a vertex list
+ * @details Duplicates and out-of-range ids in the list are ignored
+ * @param selectedVertices Vertices to keep, in any order
+ * @param numberOfVertices Number of vertices in the source graph
+ * @return SubgraphVertexMap of the selection
+ */
+SubgraphVertexMap buildSubgraphVertexMap(const std::vector<int>& selectedVertices, int numberOfVertices) {
+    VertexMembershipBitmap membership(numberOfVertices);
+    for (int vertexIndex : selectedVertices) {
+        if (vertexIndex >= 0 && vertexIndex < numberOfVertices) {
+            membership.insert(vertexIndex);
+        }
+    }
+    return buildSubgraphVertexMapFromBitmap(membership);
+}
+
+/**
+ * @brief Build the vertex map of the vertices accepted by a predicate
+ * @param numberOfVertices Number of vertices in the source graph
+ * @param keepVertex Called as keepVertex(vertex), returns true to keep the vertex
+ * @return SubgraphVertexMap of the selection
+ */
+template <typename VertexPredicate>
+SubgraphVertexMap buildSubgraphVertexMapFromPredicate(int numberOfVertices, VertexPredicate keepVertex) {
+    VertexMembershipBitmap membership(numberOfVertices);
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        if (keepVertex(vertexIndex)) {
+            membership.insert(vertexIndex);
+        }
+    }
+    return buildSubgraphVertexMapFromBitmap(membership);
+}
+
+/**
+ * @brief Extract a subgraph from a CSR layout into a new compact CSR with relabeled vertices
+ * @details Two parallel passes over the kept vertices: count kept edges per row, then, after a prefix sum,
+ *          write them. Only rows of kept vertices are scanned, so the cost is O(V) for the id map plus
+ *          the degree sum of kept vertices. keepEdge is called twice per candidate edge and must be pure.
+ * @param csrGraph The source CSR structure
+ * @param vertexMap Kept vertices and their new ids
+ * @param keepEdge Called as keepEdge(source, target), with original ids, for edges between kept vertices
+ * @return CompressedSparseRow structure of the subgraph in new ids
+ */
+template <typename EdgePredicate>
+CompressedSparseRow extractFilteredCompressedSparseRow(const CompressedSparseRow& csrGraph, const SubgraphVertexMap& vertexMap,
+                                                       EdgePredicate keepEdge) {
+    int subgraphVertexCount = static_cast<int>(vertexMap.originalIdOfVertex.size());
+    CompressedSparseRow subgraph;
+    subgraph.numberOfVertices = subgraphVertexCount;
+    subgraph.rowOffsets.assign(subgraphVertexCount + 1, 0);
+
+    // Pass 1: row lengths, written one slot ahead so the prefix sum turns them into offsets in place
+    runParallelForRange(subgraphVertexCount, [&](int rowBegin, int rowEnd) {
+        for (int newVertex = rowBegin; newVertex < rowEnd; ++newVertex) {
+            int sourceVertex = vertexMap.originalIdOfVertex[newVertex];
+            int keptCount = 0;
+            for (int position = csrGraph.rowOffsets[sourceVertex]; position < csrGraph.rowOffsets[sourceVertex + 1]; ++position) {
+                int targetVertex = csrGraph.columnIndices[position];
+                if (vertexMap.membership.contains(targetVertex) && keepEdge(sourceVertex, targetVertex)) {
+                    keptCount++;
+                }
+            }
+            subgraph.rowOffsets[newVertex + 1] = keptCount;
+        }
+    });
+    for (int newVertex = 0; newVertex < subgraphVertexCount; ++newVertex) {
+        subgraph.rowOffsets[newVertex + 1] += subgraph.rowOffsets[newVertex];
+    }
+
+    // Pass 2: every row owns a disjoint slice of columnIndices
+    subgraph.columnIndices.resize(subgraph.rowOffsets[subgraphVertexCount]);
+    runParallelForRange(subgraphVertexCount, [&](int rowBegin, int rowEnd) {
+        for (int newVertex = rowBegin; newVertex < rowEnd; ++newVertex) {
+            int sourceVertex = vertexMap.originalIdOfVertex[newVertex];
+            int writePosition = subgraph.rowOffsets[newVertex];
+            for (int position = csrGraph.rowOffsets[sourceVertex]; position < csrGraph.rowOffsets[sourceVertex + 1]; ++position) {
+                int targetVertex = csrGraph.columnIndices[position];
+                if (vertexMap.membership.contains(targetVertex) && keepEdge(sourceVertex, targetVertex)) {
+                    subgraph.columnIndices[writePosition++] = vertexMap.newIdOfVertex[targetVertex];
+                }
+            }
+        }
+    });
+
+    subgraph.numberOfEdges = static_cast<int>(subgraph.columnIndices.size());
+    return subgraph;
+}
+
+/**
+ * @brief Extract the subgraph induced by a vertex selection from a CSR layout
+ * @param csrGraph The source CSR structure
+ * @param vertexMap Kept vertices and their new ids
+ * @return CompressedSparseRow structure of the induced subgraph in new ids
+ */
+CompressedSparseRow extractInducedSubgraphFromCompressedSparseRow(const CompressedSparseRow& csrGraph, const SubgraphVertexMap& vertexMap) {
+    return extractFilteredCompressedSparseRow(csrGraph, vertexMap, [](int, int) { return true; });
+}
+
+/**
+ * @brief Keep only the CSR edges accepted by a predicate; vertex ids are unchanged
+ * @param csrGraph The source CSR structure
+ * @param keepEdge Called as keepEdge(source, target), must be pure
+ * @return CompressedSparseRow structure with the kept edges
+ */
+template <typename EdgePredicate>
+CompressedSparseRow filterCompressedSparseRowEdges(const CompressedSparseRow& csrGraph, EdgePredicate keepEdge) {
+    SubgraphVertexMap allVertices = buildSubgraphVertexMapFromPredicate(csrGraph.numberOfVertices, [](int) { return true; });
+    return extractFilteredCompressedSparseRow(csrGraph, allVertices, keepEdge);
+}
+
+/**
+ * @brief Extract a subgraph from an adjacency list into a new adjacency list with relabeled vertices
+ * @details Each kept vertex fills only its own row, so rows are built in parallel without coordination
+ * @param adjacencyList The source adjacency list
+ * @param vertexMap Kept vertices and their new ids
+ * @param keepEdge Called as keepEdge(source, target), with original ids, for edges between kept vertices
+ * @return AdjacencyList structure of the subgraph in new ids
+ */
+template <typename EdgePredicate>
+AdjacencyList extractFilteredAdjacencyList(const AdjacencyList& adjacencyList, const SubgraphVertexMap& vertexMap,
+                                           EdgePredicate keepEdge) {
+    int subgraphVertexCount = static_cast<int>(vertexMap.originalIdOfVertex.size());
+    AdjacencyList subgraph;
+    subgraph.numberOfVertices = subgraphVertexCount;
+    subgraph.adjacencyData.resize(subgraphVertexCount);
+
+    runParallelForRange(subgraphVertexCount, [&](int rowBegin, int rowEnd) {
+        for (int newVertex = rowBegin; newVertex < rowEnd; ++newVertex) {
+            int sourceVertex = vertexMap.originalIdOfVertex[newVertex];
+            for (int targetVertex : adjacencyList.adjacencyData[sourceVertex]) {
+                if (vertexMap.membership.contains(targetVertex) && keepEdge(sourceVertex, targetVertex)) {
+                    subgraph.adjacencyData[newVertex].push_back(vertexMap.newIdOfVertex[targetVertex]);
+                }
+            }
+        }
+    });
+    return subgraph;
+}
+
+/**
+ * @brief Extract the subgraph induced by a vertex selection from an adjacency list
+ * @param adjacencyList The source adjacency list
+ * @param vertexMap Kept vertices and their new ids
+ * @return AdjacencyList structure of the induced subgraph in new ids
+ */
+AdjacencyList extractInducedSubgraphFromAdjacencyList(const AdjacencyList& adjacencyList, const SubgraphVertexMap& vertexMap) {
+    return extractFilteredAdjacencyList(adjacencyList, vertexMap, [](int, int) { return true; });
+}
+
+/**
+ * @brief Keep only the adjacency list edges accepted by a predicate; vertex ids are unchanged
+ * @param adjacencyList The source adjacency list
+ * @param keepEdge Called as keepEdge(source, target)
+ * @return AdjacencyList structure with the kept edges
+ */
+template <typename EdgePredicate>
+AdjacencyList filterAdjacencyListEdges(const AdjacencyList& adjacencyList, EdgePredicate keepEdge) {
+    SubgraphVertexMap allVertices = buildSubgraphVertexMapFromPredicate(adjacencyList.numberOfVertices, [](int) { return true; });
+    return extractFilteredAdjacencyList(adjacencyList, allVertices, keepEdge);
+}
@@ -0,0 +1,323 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <algorithm>
+#include <cstdint>
+#include <atomic>
+
+/**
+ * @brief Largest vertex count for which the V x V bit matrix (V^2 / 8 bytes) is considered
+ */
+const int TRIANGLE_BIT_MATRIX_VERTEX_LIMIT = 16384;
+
+/**
+ * @brief Structure to hold triangle counts and clustering coefficients of a simple graph
+ * @details Counts refer to the undirected graph underlying the directed edges, so u->v and v->u are one edge
+ */
+struct TriangleCountResult {
+    std::vector<long long> vertexTriangleCounts;
+    std::vector<double> localClusteringCoefficients;
+    std::vector<int> undirectedDegrees;
+    long long totalTriangleCount;
+    double averageClusteringCoefficient;
+    std::string countingMode;
+
+    /**
+     * @brief Default constructor
+     */
+    TriangleCountResult() : totalTriangleCount(0), averageClusteringCoefficient(0.0) {}
+
+    /**
+     * @brief Constructor with vertex count
+     * @param vertexCount Number of vertices in the graph
+     */
+    TriangleCountResult(int vertexCount) : totalTriangleCount(0), averageClusteringCoefficient(0.0) {
+        vertexTriangleCounts.assign(vertexCount, 0);
+        localClusteringCoefficients.assign(vertexCount, 0.0);
+        undirectedDegrees.assign(vertexCount, 0);
+    }
+};
+
+/**
+ * @brief Build the symmetric CSR of the undirected graph underlying a directed simple graph
+ * @param adjacencyData Adjacency list data
+ * @param numberOfVertices Number of vertices in the graph
+ * @return CompressedSparseRow with sorted rows, each undirected edge stored in both directions
+ */
+CompressedSparseRow buildUndirectedCompressedSparseRow(const std::vector<std::vector<int>>& adjacencyData, int numberOfVertices) {
+    CompressedSparseRow undirectedGraph(numberOfVertices);
+    std::vector<int> rowLengths(numberOfVertices + 1, 0);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyData[sourceVertex]) {
+            rowLengths[sourceVertex + 1]++;
+            rowLengths[targetVertex + 1]++;
+        }
+    }
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        rowLengths[vertexIndex + 1] += rowLengths[vertexIndex];
+    }
+
+    std::vector<int> mirroredNeighbors(rowLengths[numberOfVertices]);
+    std::vector<int> writeCursor(rowLengths.begin(), rowLengths.end() - 1);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int targetVertex : adjacencyData[sourceVertex]) {
+            mirroredNeighbors[writeCursor[sourceVertex]++] = targetVertex;
+            mirroredNeighbors[writeCursor[targetVertex]++] = sourceVertex;
+        }
+    }
+
+    // Sort each row and drop the copy that appears when both u->v and v->u exist
+    undirectedGraph.columnIndices.reserve(mirroredNeighbors.size());
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        auto rowBegin = mirroredNeighbors.begin() + rowLengths[vertexIndex];
+        auto rowEnd = mirroredNeighbors.begin() + rowLengths[vertexIndex + 1];
+        std::sort(rowBegin, rowEnd);
+        undirectedGraph.columnIndices.insert(undirectedGraph.columnIndices.end(), rowBegin, std::unique(rowBegin, rowEnd));
+        undirectedGraph.rowOffsets.push_back(static_cast<int>(undirectedGraph.columnIndices.size()));
+    }
+    undirectedGraph.numberOfEdges = static_cast<int>(undirectedGraph.columnIndices.size()) / 2;
+    return undirectedGraph;
+}
+
+/**
+ * @brief Fill degrees, clustering coefficients and the total once per-vertex triangle counts are known
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @param triangleResult Result whose vertexTriangleCounts are already filled
+ */
+void finalizeTriangleCountResult(const CompressedSparseRow& undirectedGraph, TriangleCountResult& triangleResult) {
+    long long triangleCornerSum = 0;
+    double clusteringSum = 0.0;
+    for (int vertexIndex = 0; vertexIndex < undirectedGraph.numberOfVertices; ++vertexIndex) {
+        long long vertexDegree = undirectedGraph.rowOffsets[vertexIndex + 1] - undirectedGraph.rowOffsets[vertexIndex];
+        triangleResult.undirectedDegrees[vertexIndex] = static_cast<int>(vertexDegree);
+        if (vertexDegree >= 2) {
+            triangleResult.localClusteringCoefficients[vertexIndex] =
+                2.0 * triangleResult.vertexTriangleCounts[vertexIndex] / (vertexDegree * (vertexDegree - 1));
+        }
+        triangleCornerSum += triangleResult.vertexTriangleCounts[vertexIndex];
+        clusteringSum += triangleResult.localClusteringCoefficients[vertexIndex];
+    }
+    triangleResult.totalTriangleCount = triangleCornerSum / 3;
+    if (undirectedGraph.numberOfVertices > 0) {
+        triangleResult.averageClusteringCoefficient = clusteringSum / undirectedGraph.numberOfVertices;
+    }
+}
+
+/**
+ * @brief Count triangles by AND-ing bit matrix rows and counting set bits, suited to dense graphs
+ * @details For every edge (u, v) with u < v, popcount(row[u] & row[v]) is the number of triangles on that edge.
+ *          Each triangle at a vertex is seen from its two incident triangle edges, hence the final halving.
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return TriangleCountResult with per-vertex counts and clustering coefficients
+ */
+TriangleCountResult countTrianglesWithBitMatrix(const CompressedSparseRow& undirectedGraph) {
+    int numberOfVertices = undirectedGraph.numberOfVertices;
+    TriangleCountResult triangleResult(numberOfVertices);
+    triangleResult.countingMode = "bit-matrix";
+
+    std::size_t wordsPerRow = (static_cast<std::size_t>(numberOfVertices) + 63) / 64;
+    std::vector<std::uint64_t> bitMatrix(wordsPerRow * numberOfVertices, 0);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        std::uint64_t* rowBits = &bitMatrix[sourceVertex * wordsPerRow];
+        for (int position = undirectedGraph.rowOffsets[sourceVertex]; position < undirectedGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            int targetVertex = undirectedGraph.columnIndices[position];
+            rowBits[targetVertex >> 6] |= static_cast<std::uint64_t>(1) << (targetVertex & 63);
+        }
+    }
+
+    std::vector<long long> edgeTriangleSums(numberOfVertices, 0);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        const std::uint64_t* sourceBits = &bitMatrix[sourceVertex * wordsPerRow];
+        for (int position = undirectedGraph.rowOffsets[sourceVertex]; position < undirectedGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            int targetVertex = undirectedGraph.columnIndices[position];
+            if (targetVertex <= sourceVertex) {
+                continue;
+            }
+            const std::uint64_t* targetBits = &bitMatrix[targetVertex * wordsPerRow];
+            long long commonNeighbors = 0;
+            for (std::size_t wordIndex = 0; wordIndex < wordsPerRow; ++wordIndex) {
+                commonNeighbors += __builtin_popcountll(sourceBits[wordIndex] & targetBits[wordIndex]);
+            }
+            edgeTriangleSums[sourceVertex] += commonNeighbors;
+            edgeTriangleSums[targetVertex] += commonNeighbors;
+        }
+    }
+
+    for (int vertexIndex = 0; vertexIndex < numberOfVertices; ++vertexIndex) {
+        triangleResult.vertexTriangleCounts[vertexIndex] = edgeTriangleSums[vertexIndex] / 2;
+    }
+    finalizeTriangleCountResult(undirectedGraph, triangleResult);
+    return triangleResult;
+}
+
+/**
+ * @brief Orient every undirected edge from lower to higher (degree, id) rank
+ * @details Each vertex keeps at most O(sqrt(E)) forward neighbors, which bounds the merge work by O(E^1.5)
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return CSR holding only forward edges, rows sorted by vertex id
+ */
+CompressedSparseRow buildDegreeOrderedForwardGraph(const CompressedSparseRow& undirectedGraph) {
+    int numberOfVertices = undirectedGraph.numberOfVertices;
+    auto rankBefore = [&](int leftVertex, int rightVertex) {
+        int leftDegree = undirectedGraph.rowOffsets[leftVertex + 1] - undirectedGraph.rowOffsets[leftVertex];
+        int rightDegree = undirectedGraph.rowOffsets[rightVertex + 1] - undirectedGraph.rowOffsets[rightVertex];
+        return leftDegree < rightDegree || (leftDegree == rightDegree && leftVertex < rightVertex);
+    };
+
+    CompressedSparseRow forwardGraph(numberOfVertices);
+    forwardGraph.columnIndices.reserve(undirectedGraph.numberOfEdges);
+    for (int sourceVertex = 0; sourceVertex < numberOfVertices; ++sourceVertex) {
+        for (int position = undirectedGraph.rowOffsets[sourceVertex]; position < undirectedGraph.rowOffsets[sourceVertex + 1]; ++position) {
+            int targetVertex = undirectedGraph.columnIndices[position];
+            if (rankBefore(sourceVertex, targetVertex)) {
+                forwardGraph.columnIndices.push_back(targetVertex);
+            }
+        }
+        forwardGraph.rowOffsets.push_back(static_cast<int>(forwardGraph.columnIndices.size()));
+    }
+    forwardGraph.numberOfEdges = static_cast<int>(forwardGraph.columnIndices.size());
+    return forwardGraph;
+}
+
+/**
+ * @brief Add to one per-vertex triangle counter of a single-threaded count
+ * @param vertexTriangleCounts Per-vertex counters
+ * @param vertexIndex Counter to increment
+ * @param triangleCount Amount to add
+ */
+inline void addVertexTriangleCount(std::vector<long long>& vertexTriangleCounts, int vertexIndex, long long triangleCount) {
+    vertexTriangleCounts[vertexIndex] += triangleCount;
+}
+
+/**
+ * @brief Add to one per-vertex triangle counter shared between threads
+ * @param vertexTriangleCounts Per-vertex counters
+ * @param vertexIndex Counter to increment
+ * @param triangleCount Amount to add
+ */
+inline void addVertexTriangleCount(std::vector<std::atomic<long long>>& vertexTriangleCounts, int vertexIndex, long long triangleCount) {
+    vertexTriangleCounts[vertexIndex].fetch_add(triangleCount, std::memory_order_relaxed);
+}
+
+/**
+ * @brief Count triangles whose lowest-ranked vertex lies in [rangeBegin, rangeEnd) by sorted merge intersection
+ * @details The source vertex count is summed locally and added once per source; the other two corners are added
+ *          per triangle
+ * @param forwardGraph Degree-ordered forward CSR
+ * @param rangeBegin First source vertex
+ * @param rangeEnd One past the last source vertex
+ * @param vertexTriangleCounts Per-vertex counters to increment, plain or atomic
+ */
+template <typename TriangleCountVector>
+void countForwardTrianglesInRange(const CompressedSparseRow& forwardGraph, int rangeBegin, int rangeEnd,
+                                  TriangleCountVector& vertexTriangleCounts) {
+    for (int sourceVertex = rangeBegin; sourceVertex < rangeEnd; ++sourceVertex) {
+        int sourceBegin = forwardGraph.rowOffsets[sourceVertex];
+        int sourceEnd = forwardGraph.rowOffsets[sourceVertex + 1];
+        long long sourceTriangleCount = 0;
+        for (int position = sourceBegin; position < sourceEnd; ++position) {
+            int middleVertex = forwardGraph.columnIndices[position];
+            int leftCursor = sourceBegin;
+            int rightCursor = forwardGraph.rowOffsets[middleVertex];
+            int rightEnd = forwardGraph.rowOffsets[middleVertex + 1];
+            while (leftCursor < sourceEnd && rightCursor < rightEnd) {
+                int leftNeighbor = forwardGraph.columnIndices[leftCursor];
+                int rightNeighbor = forwardGraph.columnIndices[rightCursor];
+                if (leftNeighbor < rightNeighbor) {
+                    leftCursor++;
+                } else if (rightNeighbor < leftNeighbor) {
+                    rightCursor++;
+                } else {
+                    sourceTriangleCount++;
+                    addVertexTriangleCount(vertexTriangleCounts, middleVertex, 1);
+                    addVertexTriangleCount(vertexTriangleCounts, leftNeighbor, 1);
+                    leftCursor++;
+                    rightCursor++;
+                }
+            }
+        }
+        if (sourceTriangleCount != 0) {
+            addVertexTriangleCount(vertexTriangleCounts, sourceVertex, sourceTriangleCount);
+        }
+    }
+}
+
+/**
+ * @brief Count triangles by degree-ordered merge intersection over sorted CSR, suited to sparse graphs
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return TriangleCountResult with per-vertex counts and clustering coefficients
+ */
+TriangleCountResult countTrianglesWithSortedMerge(const CompressedSparseRow& undirectedGraph) {
+    TriangleCountResult triangleResult(undirectedGraph.numberOfVertices);
+    triangleResult.countingMode = "sorted-merge";
+
+    CompressedSparseRow forwardGraph = buildDegreeOrderedForwardGraph(undirectedGraph);
+    countForwardTrianglesInRange(forwardGraph, 0, forwardGraph.numberOfVertices, triangleResult.vertexTriangleCounts);
+
+    finalizeTriangleCountResult(undirectedGraph, triangleResult);
+    return triangleResult;
+}
+
+/**
+ * @brief Count triangles by degree-ordered merge intersection with source vertices split across threads
+ * @details All workers add into one array of atomic counters, so memory stays O(V) whatever the thread count and
+ *          no serial reduction is needed; initialization and the copy into the result are split by vertex range
+ * @param undirectedGraph Symmetric CSR of the graph
+ * @return TriangleCountResult with per-vertex counts and clustering coefficients
+ */
+TriangleCountResult countTrianglesWithSortedMergeParallel(const CompressedSparseRow& undirectedGraph) {
+    TriangleCountResult triangleResult(undirectedGraph.numberOfVertices);
+    triangleResult.countingMode = "sorted-merge-parallel";
+
+    CompressedSparseRow forwardGraph = buildDegreeOrderedForwardGraph(undirectedGraph);
+    int numberOfVertices = forwardGraph.numberOfVertices;
+    std::vector<std::atomic<long long>> sharedTriangleCounts(numberOfVertices);
+    runParallelForRange(numberOfVertices, [&](int rangeBegin, int rangeEnd) {
+        for (int vertexIndex = rangeBegin; vertexIndex < rangeEnd; ++vertexIndex) {
+            sharedTriangleCounts[vertexIndex].store(0, std::memory_order_relaxed);
+        }
+    });
+    runParallelForRange(numberOfVertices, [&](int rangeBegin, int rangeEnd) {
+        countForwardTrianglesInRange(forwardGraph, rangeBegin, rangeEnd, sharedTriangleCounts);
+    });
+    runParallelForRange(numberOfVertices, [&](int rangeBegin, int rangeEnd) {
+        for (int vertexIndex = rangeBegin; vertexIndex < rangeEnd; ++vertexIndex) {
+            triangleResult.vertexTriangleCounts[vertexIndex] = sharedTriangleCounts[vertexIndex].load(std::memory_order_relaxed);
+        }
+    });
+
+    finalizeTriangleCountResult(undirectedGraph, triangleResult);
+    return triangleResult;
+}
+
+/**
+ * @brief Count triangles choosing the bit matrix for small dense graphs and parallel merge otherwise
+ * @details The bit matrix wins once the average degree reaches about one 64-bit word per row
+ * @param adjacencyList Simple graph adjacency list
+ * @return TriangleCountResult with per-vertex counts and clustering coefficients
+ */
+TriangleCountResult countTriangles(const AdjacencyList& adjacencyList) {
+    CompressedSparseRow undirectedGraph = buildUndirectedCompressedSparseRow(adjacencyList.adjacencyData, adjacencyList.numberOfVertices);
+    long long numberOfVertices = undirectedGraph.numberOfVertices;
+    bool isDense = 2LL * undirectedGraph.numberOfEdges * 64 >= numberOfVertices * numberOfVertices;
+    if (numberOfVertices <= TRIANGLE_BIT_MATRIX_VERTEX_LIMIT && isDense) {
+        return countTrianglesWithBitMatrix(undirectedGraph);
+    }
+    return countTrianglesWithSortedMergeParallel(undirectedGraph);
+}
+
+/**
+ * @brief Display triangle counts and local clustering coefficients to console
+ * @param triangleResult The result to display
+ */
+void displayTriangleCountResult(const TriangleCountResult& triangleResult) {
+    std::cout << "=== Triangle Count (" << triangleResult.countingMode << ") ===" << std::endl;
+    std::cout << "Total triangles: " << triangleResult.totalTriangleCount << std::endl;
+    std::cout << "Average clustering coefficient: " << triangleResult.averageClusteringCoefficient << std::endl;
+    for (int vertexIndex = 0; vertexIndex < static_cast<int>(triangleResult.vertexTriangleCounts.size()); ++vertexIndex) {
+        std::cout << "Vertex " << vertexIndex << ": degree " << triangleResult.undirectedDegrees[vertexIndex]
+                  << ", triangles " << triangleResult.vertexTriangleCounts[vertexIndex]
+                  << ", clustering " << triangleResult.localClusteringCoefficients[vertexIndex] << std::endl;
+    }
+    std::cout << std::endl;
+}
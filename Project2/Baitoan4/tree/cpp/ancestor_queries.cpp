@@ -0,0 +1,320 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Structure to represent binary lifting table for k-th ancestor queries
+ * @details ancestorTable[level * numberOfNodes + v] is the 2^level-th ancestor of v (the root maps to itself).
+ *          All arrays are flat int32 so a 10^8-node tree costs 4 bytes per node per level.
+ */
+struct BinaryLiftingTable {
+    std::vector<std::int32_t> ancestorTable;
+    std::vector<std::int32_t> depthArray;
+    int numberOfNodes;
+    int levelCount;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    BinaryLiftingTable() : numberOfNodes(0), levelCount(0), rootNode(NIL_VALUE) {}
+};
+
+/**
+ * @brief Structure to represent Euler tour (preorder) plus sparse table for O(1) LCA queries
+ * @details For pre[u] < pre[v], LCA(u, v) is the node whose preorder index is the minimum of
+ *          pre[parent[x]] over the nodes x at preorder positions (pre[u], pre[v]].
+ *          sparseTable[level * numberOfNodes + i] holds that minimum over positions [i, i + 2^level).
+ *          Using the n-entry preorder instead of the 2n-entry Euler sequence halves the table.
+ */
+struct EulerTourLcaTable {
+    std::vector<std::int32_t> preorderIndex;
+    std::vector<std::int32_t> preorderSequence;
+    std::vector<std::int32_t> sparseTable;
+    int numberOfNodes;
+    int levelCount;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    EulerTourLcaTable() : numberOfNodes(0), levelCount(0), rootNode(NIL_VALUE) {}
+};
+
+/**
+ * @brief Compute floor(log2(value)) for a positive value
+ * @param value Positive integer
+ * @return Index of the highest set bit
+ */
+inline int computeFloorLog2(unsigned int value) {
+    return 31 - __builtin_clz(value);
+}
+
+/**
+ * @brief Build binary lifting table from array of parents
+ * @details Depths follow the preorder sequence; each lifting level is then filled in parallel
+ * @param parentArray Array of parent pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return BinaryLiftingTable structure ready for k-th ancestor and LCA queries
+ */
+BinaryLiftingTable buildBinaryLiftingTable(const std::vector<int>& parentArray, int numberOfNodes) {
+    BinaryLiftingTable liftingTable;
+    liftingTable.numberOfNodes = numberOfNodes;
+
+    PreorderIntervalTree intervalTree = convertArrayParentsToPreorderInterval(parentArray, numberOfNodes);
+    liftingTable.rootNode = intervalTree.rootNode;
+
+    // Depth of every node, parents are always visited before children in preorder
+    liftingTable.depthArray.assign(numberOfNodes, NIL_VALUE);
+    int maximumDepth = 0;
+    for (int nodeIndex : intervalTree.preorderSequence) {
+        int parentNode = parentArray[nodeIndex];
+        liftingTable.depthArray[nodeIndex] = (parentNode == NIL_VALUE) ? 0 : liftingTable.depthArray[parentNode] + 1;
+        maximumDepth = std::max(maximumDepth, static_cast<int>(liftingTable.depthArray[nodeIndex]));
+    }
+
+    liftingTable.levelCount = (maximumDepth > 0) ? computeFloorLog2(maximumDepth) + 1 : 1;
+    liftingTable.ancestorTable.resize(static_cast<std::size_t>(liftingTable.levelCount) * numberOfNodes);
+
+    // Level 0: direct parent, root (and unreachable nodes) point to themselves
+    std::int32_t* baseLevel = liftingTable.ancestorTable.data();
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            baseLevel[nodeIndex] = (parentArray[nodeIndex] == NIL_VALUE) ? nodeIndex : parentArray[nodeIndex];
+        }
+    });
+
+    // Level j: jump 2^(j-1) twice
+    for (int levelIndex = 1; levelIndex < liftingTable.levelCount; ++levelIndex) {
+        const std::int32_t* previousLevel = baseLevel + static_cast<std::size_t>(levelIndex - 1) * numberOfNodes;
+        std::int32_t* currentLevel = baseLevel + static_cast<std::size_t>(levelIndex) * numberOfNodes;
+        runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+            for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+                currentLevel[nodeIndex] = previousLevel[previousLevel[nodeIndex]];
+            }
+        });
+    }
+
+    return liftingTable;
+}
+
+/**
+ * @brief Find the k-th ancestor of a node using binary lifting
+ * @param liftingTable Prebuilt binary lifting table
+ * @param nodeIndex Starting node
+ * @param ancestorDistance Number of levels to climb (0 returns the node itself)
+ * @return The k-th ancestor, or NIL_VALUE if it does not exist
+ */
+int findKthAncestor(const BinaryLiftingTable& liftingTable, int nodeIndex, int ancestorDistance) {
+    if (nodeIndex < 0 || nodeIndex >= liftingTable.numberOfNodes || ancestorDistance < 0 ||
+        liftingTable.depthArray[nodeIndex] == NIL_VALUE || ancestorDistance > liftingTable.depthArray[nodeIndex]) {
+        return NIL_VALUE;
+    }
+
+    int currentNode = nodeIndex;
+    for (int levelIndex = 0; ancestorDistance > 0; ++levelIndex, ancestorDistance >>= 1) {
+        if (ancestorDistance & 1) {
+            currentNode = liftingTable.ancestorTable[static_cast<std::size_t>(levelIndex) * liftingTable.numberOfNodes + currentNode];
+        }
+    }
+    return currentNode;
+}
+
+/**
+ * @brief Find the lowest common ancestor of two nodes using binary lifting in O(log n)
+ * @param liftingTable Prebuilt binary lifting table
+ * @param firstNode First node
+ * @param secondNode Second node
+ * @return Lowest common ancestor, or NIL_VALUE for invalid input
+ */
+int findLowestCommonAncestorByLifting(const BinaryLiftingTable& liftingTable, int firstNode, int secondNode) {
+    if (firstNode < 0 || firstNode >= liftingTable.numberOfNodes ||
+        secondNode < 0 || secondNode >= liftingTable.numberOfNodes ||
+        liftingTable.depthArray[firstNode] == NIL_VALUE || liftingTable.depthArray[secondNode] == NIL_VALUE) {
+        return NIL_VALUE;
+    }
+
+    // Bring both nodes to the same depth
+    if (liftingTable.depthArray[firstNode] < liftingTable.depthArray[secondNode]) {
+        std::swap(firstNode, secondNode);
+    }
+    firstNode = findKthAncestor(liftingTable, firstNode, liftingTable.depthArray[firstNode] - liftingTable.depthArray[secondNode]);
+    if (firstNode == secondNode) {
+        return firstNode;
+    }
+
+    // Climb both while their ancestors differ
+    for (int levelIndex = liftingTable.levelCount - 1; levelIndex >= 0; --levelIndex) {
+        const std::int32_t* currentLevel = liftingTable.ancestorTable.data() + static_cast<std::size_t>(levelIndex) * liftingTable.numberOfNodes;
+        if (currentLevel[firstNode] != currentLevel[secondNode]) {
+            firstNode = currentLevel[firstNode];
+            secondNode = currentLevel[secondNode];
+        }
+    }
+    return liftingTable.ancestorTable[firstNode];
+}
+
+/**
+ * @brief Build Euler tour plus sparse table from array of parents
+ * @details Each sparse table level is filled in parallel from the previous one
+ * @param parentArray Array of parent pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return EulerTourLcaTable structure ready for O(1) LCA queries
+ */
+EulerTourLcaTable buildEulerTourLcaTable(const std::vector<int>& parentArray, int numberOfNodes) {
+    EulerTourLcaTable lcaTable;
+    lcaTable.numberOfNodes = numberOfNodes;
+
+    PreorderIntervalTree intervalTree = convertArrayParentsToPreorderInterval(parentArray, numberOfNodes);
+    lcaTable.rootNode = intervalTree.rootNode;
+    lcaTable.preorderIndex.assign(intervalTree.preorderIndex.begin(), intervalTree.preorderIndex.end());
+    lcaTable.preorderSequence.assign(intervalTree.preorderSequence.begin(), intervalTree.preorderSequence.end());
+
+    int visitedCount = static_cast<int>(lcaTable.preorderSequence.size());
+    lcaTable.levelCount = (visitedCount > 0) ? computeFloorLog2(visitedCount) + 1 : 1;
+    lcaTable.sparseTable.resize(static_cast<std::size_t>(lcaTable.levelCount) * numberOfNodes);
+
+    // Level 0: preorder index of the parent of the node at each preorder position
+    std::int32_t* baseLevel = lcaTable.sparseTable.data();
+    runParallelForRange(visitedCount, [&](int rangeBegin, int rangeEnd) {
+        for (int position = rangeBegin; position < rangeEnd; ++position) {
+            int parentNode = parentArray[lcaTable.preorderSequence[position]];
+            baseLevel[position] = (parentNode == NIL_VALUE) ? 0 : lcaTable.preorderIndex[parentNode];
+        }
+    });
+
+    for (int levelIndex = 1; levelIndex < lcaTable.levelCount; ++levelIndex) {
+        const std::int32_t* previousLevel = baseLevel + static_cast<std::size_t>(levelIndex - 1) * numberOfNodes;
+        std::int32_t* currentLevel = baseLevel + static_cast<std::size_t>(levelIndex) * numberOfNodes;
+        int halfSpan = 1 << (levelIndex - 1);
+        int validCount = visitedCount - (1 << levelIndex) + 1;
+        runParallelForRange(validCount, [&](int rangeBegin, int rangeEnd) {
+            for (int position = rangeBegin; position < rangeEnd; ++position) {
+                currentLevel[position] = std::min(previousLevel[position], previousLevel[position + halfSpan]);
+            }
+        });
+    }
+
+    return lcaTable;
+}
+
+/**
+ * @brief Find the lowest common ancestor of two nodes in O(1) with the Euler tour sparse table
+ * @param lcaTable Prebuilt Euler tour sparse table
+ * @param firstNode First node
+ * @param secondNode Second node
+ * @return Lowest common ancestor, or NIL_VALUE for invalid input
+ */
+int findLowestCommonAncestor(const EulerTourLcaTable& lcaTable, int firstNode, int secondNode) {
+    if (firstNode < 0 || firstNode >= lcaTable.numberOfNodes ||
+        secondNode < 0 || secondNode >= lcaTable.numberOfNodes) {
+        return NIL_VALUE;
+    }
+    int firstPosition = lcaTable.preorderIndex[firstNode];
+    int secondPosition = lcaTable.preorderIndex[secondNode];
+    if (firstPosition == NIL_VALUE || secondPosition == NIL_VALUE) {
+        return NIL_VALUE;
+    }
+    if (firstPosition == secondPosition) {
+        return firstNode;
+    }
+    if (firstPosition > secondPosition) {
+        std::swap(firstPosition, secondPosition);
+    }
+
+    // Minimum over positions (firstPosition, secondPosition] from two overlapping blocks
+    int rangeLength = secondPosition - firstPosition;
+    int levelIndex = computeFloorLog2(rangeLength);
+    const std::int32_t* currentLevel = lcaTable.sparseTable.data() + static_cast<std::size_t>(levelIndex) * lcaTable.numberOfNodes;
+    int ancestorPosition = std::min(currentLevel[firstPosition + 1], currentLevel[secondPosition - (1 << levelIndex) + 1]);
+    return lcaTable.preorderSequence[ancestorPosition];
+}
+
+/**
+ * @brief Read batched node pair queries from file
+ * @details Format: query count Q followed by Q lines "a b" (two nodes for LCA, or node and k for k-th ancestor)
+ * @param fileName Name of input file
+ * @return List of query pairs
+ */
+std::vector<std::pair<int, int>> readNodePairQueriesFromFile(const std::string& fileName) {
+    std::vector<std::pair<int, int>> queryPairs;
+    std::ifstream inputFile(fileName);
+    if (!inputFile.is_open()) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return queryPairs;
+    }
+
+    int numberOfQueries;
+    inputFile >> numberOfQueries;
+    queryPairs.resize(numberOfQueries);
+    for (int queryIndex = 0; queryIndex < numberOfQueries; ++queryIndex) {
+        inputFile >> queryPairs[queryIndex].first >> queryPairs[queryIndex].second;
+    }
+
+    inputFile.close();
+    return queryPairs;
+}
+
+/**
+ * @brief Answer a batch of LCA queries in parallel
+ * @param lcaTable Prebuilt Euler tour sparse table
+ * @param queryPairs Node pairs to query
+ * @return LCA for every query, in input order
+ */
+std::vector<int> answerLowestCommonAncestorQueries(const EulerTourLcaTable& lcaTable,
+                                                   const std::vector<std::pair<int, int>>& queryPairs) {
+    std::vector<int> queryAnswers(queryPairs.size());
+    runParallelForRange(static_cast<int>(queryPairs.size()), [&](int rangeBegin, int rangeEnd) {
+        for (int queryIndex = rangeBegin; queryIndex < rangeEnd; ++queryIndex) {
+            queryAnswers[queryIndex] = findLowestCommonAncestor(lcaTable, queryPairs[queryIndex].first, queryPairs[queryIndex].second);
+        }
+    });
+    return queryAnswers;
+}
+
+/**
+ * @brief Answer a batch of k-th ancestor queries in parallel
+ * @param liftingTable Prebuilt binary lifting table
+ * @param queryPairs (node, k) pairs to query
+ * @return k-th ancestor for every query, in input order
+ */
+std::vector<int> answerKthAncestorQueries(const BinaryLiftingTable& liftingTable,
+                                          const std::vector<std::pair<int, int>>& queryPairs) {
+    std::vector<int> queryAnswers(queryPairs.size());
+    runParallelForRange(static_cast<int>(queryPairs.size()), [&](int rangeBegin, int rangeEnd) {
+        for (int queryIndex = rangeBegin; queryIndex < rangeEnd; ++queryIndex) {
+            queryAnswers[queryIndex] = findKthAncestor(liftingTable, queryPairs[queryIndex].first, queryPairs[queryIndex].second);
+        }
+    });
+    return queryAnswers;
+}
+
+/**
+ * @brief Write batched query answers to output file, one per line
+ * @param queryAnswers Answers to write
+ * @param fileName Name of output file
+ */
+void writeQueryAnswersToFile(const std::vector<int>& queryAnswers, const std::string& fileName) {
+    std::ofstream outputFile(fileName);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return;
+    }
+
+    for (int answer : queryAnswers) {
+        if (answer == NIL_VALUE) {
+            outputFile << "nil" << '\n';
+        } else {
+            outputFile << answer << '\n';
+        }
+    }
+
+    outputFile.flush();
+    outputFile.close();
+}
@@ -0,0 +1,419 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+#include <cstdint>
+#include <cstring>
+#include <utility>
+
+#ifdef _WIN32
+#ifndef NOMINMAX
+#define NOMINMAX
+#endif
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Layout kinds stored in the binary tree file header
+ */
+const std::uint32_t TREE_BINARY_LAYOUT_PARENTS = 1;
+const std::uint32_t TREE_BINARY_LAYOUT_FIRST_CHILD_NEXT_SIBLING = 2;
+const std::uint32_t TREE_BINARY_FORMAT_VERSION = 1;
+const char TREE_BINARY_MAGIC[8] = {'T', 'R', 'E', 'E', 'B', 'I', 'N', '\0'};
+
+/**
+ * @brief Fixed 24-byte header of the binary tree file format
+ * @details Followed by numberOfNodes native int32 values (parents), or by numberOfNodes first-child
+ *          values and then numberOfNodes next-sibling values. NIL is stored as -1.
+ */
+struct TreeBinaryHeader {
+    char magic[8];
+    std::uint32_t layoutKind;
+    std::uint32_t formatVersion;
+    std::int32_t numberOfNodes;
+    std::int32_t rootNode;
+};
+static_assert(sizeof(TreeBinaryHeader) == 24, "Binary tree header must stay 24 bytes");
+
+/**
+ * @brief Read-only memory mapping of a whole file, unmapped when destroyed
+ */
+class MappedFileRegion {
+private:
+    const unsigned char* mappedData;
+    std::size_t mappedSize;
+#ifdef _WIN32
+    HANDLE fileHandle;
+    HANDLE mappingHandle;
+#endif
+
+    /**
+     * @brief Release the mapping and any handles
+     */
+    void releaseMapping() {
+#ifdef _WIN32
+        if (mappedData != nullptr) UnmapViewOfFile(mappedData);
+        if (mappingHandle != nullptr) CloseHandle(mappingHandle);
+        if (fileHandle != INVALID_HANDLE_VALUE) CloseHandle(fileHandle);
+        mappingHandle = nullptr;
+        fileHandle = INVALID_HANDLE_VALUE;
+#else
+        if (mappedData != nullptr) munmap(const_cast<unsigned char*>(mappedData), mappedSize);
+#endif
+        mappedData = nullptr;
+        mappedSize = 0;
+    }
+
+public:
+    /**
+     * @brief Constructs an empty (unmapped) region
+     */
+#ifdef _WIN32
+    MappedFileRegion() : mappedData(nullptr), mappedSize(0), fileHandle(INVALID_HANDLE_VALUE), mappingHandle(nullptr) {}
+#else
+    MappedFileRegion() : mappedData(nullptr), mappedSize(0) {}
+#endif
+
+    MappedFileRegion(const MappedFileRegion&) = delete;
+    MappedFileRegion& operator=(const MappedFileRegion&) = delete;
+
+    /**
+     * @brief Move constructor, the source no longer owns the mapping
+     */
+    MappedFileRegion(MappedFileRegion&& other) noexcept : MappedFileRegion() {
+        *this = std::move(other);
+    }
+
+    /**
+     * @brief Move assignment, the source no longer owns the mapping
+     */
+    MappedFileRegion& operator=(MappedFileRegion&& other) noexcept {
+        if (this != &other) {
+            releaseMapping();
+            std::swap(mappedData, other.mappedData);
+            std::swap(mappedSize, other.mappedSize);
+#ifdef _WIN32
+            std::swap(fileHandle, other.fileHandle);
+            std::swap(mappingHandle, other.mappingHandle);
+#endif
+        }
+        return *this;
+    }
+
+    /**
+     * @brief Unmaps the file
+     */
+    ~MappedFileRegion() {
+        releaseMapping();
+    }
+
+    /**
+     * @brief Map a file read-only, pages are loaded lazily on first access
+     * @param fileName Name of file to map
+     * @return True if the whole file was mapped
+     */
+    bool mapFile(const std::string& fileName) {
+        releaseMapping();
+#ifdef _WIN32
+        fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr,
+                                 OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (fileHandle == INVALID_HANDLE_VALUE) return false;
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(fileHandle, &fileSize) || fileSize.QuadPart == 0) {
+            releaseMapping();
+            return false;
+        }
+        mappingHandle = CreateFileMappingA(fileHandle, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (mappingHandle == nullptr) {
+            releaseMapping();
+            return false;
+        }
+        mappedData = static_cast<const unsigned char*>(MapViewOfFile(mappingHandle, FILE_MAP_READ, 0, 0, 0));
+        if (mappedData == nullptr) {
+            releaseMapping();
+            return false;
+        }
+        mappedSize = static_cast<std::size_t>(fileSize.QuadPart);
+#else
+        int fileDescriptor = open(fileName.c_str(), O_RDONLY);
+        if (fileDescriptor < 0) return false;
+        struct stat fileStatus;
+        if (fstat(fileDescriptor, &fileStatus) != 0 || fileStatus.st_size == 0) {
+            close(fileDescriptor);
+            return false;
+        }
+        void* mappingAddress = mmap(nullptr, static_cast<std::size_t>(fileStatus.st_size), PROT_READ, MAP_PRIVATE, fileDescriptor, 0);
+        close(fileDescriptor); // The mapping stays valid after the descriptor is closed
+        if (mappingAddress == MAP_FAILED) return false;
+        mappedData = static_cast<const unsigned char*>(mappingAddress);
+        mappedSize = static_cast<std::size_t>(fileStatus.st_size);
+#endif
+        return true;
+    }
+
+    /**
+     * @brief Get start of mapped bytes
+     * @return Pointer to first byte, or nullptr if nothing is mapped
+     */
+    const unsigned char* data() const {
+        return mappedData;
+    }
+
+    /**
+     * @brief Get number of mapped bytes
+     * @return Mapped file size
+     */
+    std::size_t size() const {
+        return mappedSize;
+    }
+};
+
+/**
+ * @brief Non-owning view of an array of parents, for example over a mapped file
+ */
+struct ArrayOfParentsView {
+    const std::int32_t* parentArray;
+    int numberOfNodes;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    ArrayOfParentsView() : parentArray(nullptr), numberOfNodes(0), rootNode(NIL_VALUE) {}
+};
+
+/**
+ * @brief Non-owning view of first-child next-sibling arrays, for example over a mapped file
+ */
+struct FirstChildNextSiblingView {
+    const std::int32_t* firstChildArray;
+    const std::int32_t* nextSiblingArray;
+    int numberOfNodes;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    FirstChildNextSiblingView() : firstChildArray(nullptr), nextSiblingArray(nullptr), numberOfNodes(0), rootNode(NIL_VALUE) {}
+};
+
+/**
+ * @brief Array of parents view together with the mapping that keeps it alive
+ */
+struct MappedArrayOfParents {
+    MappedFileRegion mappedRegion;
+    ArrayOfParentsView treeView;
+};
+
+/**
+ * @brief First-child next-sibling view together with the mapping that keeps it alive
+ */
+struct MappedFirstChildNextSibling {
+    MappedFileRegion mappedRegion;
+    FirstChildNextSiblingView treeView;
+};
+
+/**
+ * @brief Write header and raw int32 arrays of a binary tree file
+ * @param fileName Name of output file
+ * @param layoutKind TREE_BINARY_LAYOUT_PARENTS or TREE_BINARY_LAYOUT_FIRST_CHILD_NEXT_SIBLING
+ * @param numberOfNodes Number of nodes in the tree
+ * @param rootNode Root node
+ * @param nodeArrays Arrays to write back to back, each of numberOfNodes entries
+ * @return True if the file was written completely
+ */
+bool writeTreeBinaryFile(const std::string& fileName, std::uint32_t layoutKind, int numberOfNodes, int rootNode,
+                         const std::vector<const std::vector<int>*>& nodeArrays) {
+    std::ofstream outputFile(fileName, std::ios::binary);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return false;
+    }
+
+    TreeBinaryHeader fileHeader;
+    std::memcpy(fileHeader.magic, TREE_BINARY_MAGIC, sizeof(fileHeader.magic));
+    fileHeader.layoutKind = layoutKind;
+    fileHeader.formatVersion = TREE_BINARY_FORMAT_VERSION;
+    fileHeader.numberOfNodes = numberOfNodes;
+    fileHeader.rootNode = rootNode;
+    outputFile.write(reinterpret_cast<const char*>(&fileHeader), sizeof(fileHeader));
+
+    // int is 32-bit on every supported target, so vectors are written without conversion
+    static_assert(sizeof(int) == sizeof(std::int32_t), "Binary tree format expects 32-bit int");
+    for (const std::vector<int>* nodeArray : nodeArrays) {
+        outputFile.write(reinterpret_cast<const char*>(nodeArray->data()),
+                         static_cast<std::streamsize>(numberOfNodes) * sizeof(std::int32_t));
+    }
+
+    outputFile.flush();
+    bool writeSucceeded = static_cast<bool>(outputFile);
+    outputFile.close();
+    return writeSucceeded;
+}
+
+/**
+ * @brief Write array of parents in binary tree format
+ * @param arrayParents The array of parents to write
+ * @param fileName Name of output file
+ * @return True if the file was written completely
+ */
+bool writeArrayOfParentsToBinaryFile(const ArrayOfParents& arrayParents, const std::string& fileName) {
+    return writeTreeBinaryFile(fileName, TREE_BINARY_LAYOUT_PARENTS, arrayParents.numberOfNodes, arrayParents.rootNode,
+                               {&arrayParents.parentArray});
+}
+
+/**
+ * @brief Write first-child next-sibling in binary tree format
+ * @param fcnsTree The first-child next-sibling structure to write
+ * @param fileName Name of output file
+ * @return True if the file was written completely
+ */
+bool writeFirstChildNextSiblingToBinaryFile(const FirstChildNextSibling& fcnsTree, const std::string& fileName) {
+    return writeTreeBinaryFile(fileName, TREE_BINARY_LAYOUT_FIRST_CHILD_NEXT_SIBLING, fcnsTree.numberOfNodes, fcnsTree.rootNode,
+                               {&fcnsTree.firstChildArray, &fcnsTree.nextSiblingArray});
+}
+
+/**
+ * @brief Map a binary tree file and validate its header against the expected layout
+ * @param fileName Name of input file
+ * @param expectedLayout Layout kind the caller wants
+ * @param arrayCount Number of int32 arrays that follow the header
+ * @param mappedRegion Output mapping
+ * @return Pointer to the validated header, or nullptr on error
+ */
+const TreeBinaryHeader* mapTreeBinaryFile(const std::string& fileName, std::uint32_t expectedLayout,
+                                          int arrayCount, MappedFileRegion& mappedRegion) {
+    if (!mappedRegion.mapFile(fileName)) {
+        std::cerr << "Error: Cannot open file " << fileName << std::endl;
+        return nullptr;
+    }
+    if (mappedRegion.size() < sizeof(TreeBinaryHeader)) {
+        std::cerr << "Error: File " << fileName << " is too small for a binary tree header" << std::endl;
+        return nullptr;
+    }
+
+    const TreeBinaryHeader* fileHeader = reinterpret_cast<const TreeBinaryHeader*>(mappedRegion.data());
+    if (std::memcmp(fileHeader->magic, TREE_BINARY_MAGIC, sizeof(fileHeader->magic)) != 0 ||
+        fileHeader->formatVersion != TREE_BINARY_FORMAT_VERSION || fileHeader->layoutKind != expectedLayout ||
+        fileHeader->numberOfNodes < 0) {
+        std::cerr << "Error: File " << fileName << " is not a supported binary tree file of the expected layout" << std::endl;
+        return nullptr;
+    }
+
+    std::size_t expectedSize = sizeof(TreeBinaryHeader)
+                             + static_cast<std::size_t>(arrayCount) * fileHeader->numberOfNodes * sizeof(std::int32_t);
+    if (mappedRegion.size() < expectedSize) {
+        std::cerr << "Error: File " << fileName << " is truncated" << std::endl;
+        return nullptr;
+    }
+    return fileHeader;
+}
+
+/**
+ * @brief Map a binary array of parents file without copying the data
+ * @param fileName Name of input file
+ * @return Mapping plus view, numberOfNodes is 0 on error
+ */
+MappedArrayOfParents readArrayOfParentsFromBinaryFile(const std::string& fileName) {
+    MappedArrayOfParents mappedTree;
+    const TreeBinaryHeader* fileHeader = mapTreeBinaryFile(fileName, TREE_BINARY_LAYOUT_PARENTS, 1, mappedTree.mappedRegion);
+    if (fileHeader == nullptr) {
+        return MappedArrayOfParents();
+    }
+
+    const std::int32_t* nodeData = reinterpret_cast<const std::int32_t*>(mappedTree.mappedRegion.data() + sizeof(TreeBinaryHeader));
+    mappedTree.treeView.parentArray = nodeData;
+    mappedTree.treeView.numberOfNodes = fileHeader->numberOfNodes;
+    mappedTree.treeView.rootNode = fileHeader->rootNode;
+    return mappedTree;
+}
+
+/**
+ * @brief Map a binary first-child next-sibling file without copying the data
+ * @param fileName Name of input file
+ * @return Mapping plus view, numberOfNodes is 0 on error
+ */
+MappedFirstChildNextSibling readFirstChildNextSiblingFromBinaryFile(const std::string& fileName) {
+    MappedFirstChildNextSibling mappedTree;
+    const TreeBinaryHeader* fileHeader = mapTreeBinaryFile(fileName, TREE_BINARY_LAYOUT_FIRST_CHILD_NEXT_SIBLING, 2, mappedTree.mappedRegion);
+    if (fileHeader == nullptr) {
+        return MappedFirstChildNextSibling();
+    }
+
+    const std::int32_t* nodeData = reinterpret_cast<const std::int32_t*>(mappedTree.mappedRegion.data() + sizeof(TreeBinaryHeader));
+    mappedTree.treeView.firstChildArray = nodeData;
+    mappedTree.treeView.nextSiblingArray = nodeData + fileHeader->numberOfNodes;
+    mappedTree.treeView.numberOfNodes = fileHeader->numberOfNodes;
+    mappedTree.treeView.rootNode = fileHeader->rootNode;
+    return mappedTree;
+}
+
+/**
+ * @brief Copy an array of parents view into an owning ArrayOfParents
+ * @param treeView View to copy
+ * @return ArrayOfParents structure usable by every existing conversion
+ */
+ArrayOfParents convertArrayOfParentsViewToArrayParents(const ArrayOfParentsView& treeView) {
+    ArrayOfParents arrayParents;
+    arrayParents.numberOfNodes = treeView.numberOfNodes;
+    arrayParents.rootNode = treeView.rootNode;
+    arrayParents.parentArray.assign(treeView.parentArray, treeView.parentArray + treeView.numberOfNodes);
+    return arrayParents;
+}
+
+/**
+ * @brief Copy a first-child next-sibling view into an owning FirstChildNextSibling
+ * @param treeView View to copy
+ * @return FirstChildNextSibling structure usable by every existing conversion
+ */
+FirstChildNextSibling convertFirstChildNextSiblingViewToFirstChildNextSibling(const FirstChildNextSiblingView& treeView) {
+    FirstChildNextSibling fcnsTree;
+    fcnsTree.numberOfNodes = treeView.numberOfNodes;
+    fcnsTree.rootNode = treeView.rootNode;
+    fcnsTree.firstChildArray.assign(treeView.firstChildArray, treeView.firstChildArray + treeView.numberOfNodes);
+    fcnsTree.nextSiblingArray.assign(treeView.nextSiblingArray, treeView.nextSiblingArray + treeView.numberOfNodes);
+    return fcnsTree;
+}
+
+/**
+ * @brief Display array of parents view to console
+ * @param treeView The view to display
+ */
+void displayArrayOfParentsView(const ArrayOfParentsView& treeView) {
+    std::cout << "=== Array of Parents (mapped view) ===" << std::endl;
+    std::cout << "Number of nodes: " << treeView.numberOfNodes << std::endl;
+    std::cout << "Root node: " << treeView.rootNode << std::endl;
+
+    for (int nodeIndex = 0; nodeIndex < treeView.numberOfNodes; ++nodeIndex) {
+        std::cout << "parent[" << nodeIndex << "] = "
+                  << (treeView.parentArray[nodeIndex] == NIL_VALUE ? "nil" : std::to_string(treeView.parentArray[nodeIndex]))
+                  << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Display first-child next-sibling view to console
+ * @param treeView The view to display
+ */
+void displayFirstChildNextSiblingView(const FirstChildNextSiblingView& treeView) {
+    std::cout << "=== First-Child Next-Sibling Representation (mapped view) ===" << std::endl;
+    std::cout << "Number of nodes: " << treeView.numberOfNodes << std::endl;
+    std::cout << "Root node: " << treeView.rootNode << std::endl;
+
+    for (int nodeIndex = 0; nodeIndex < treeView.numberOfNodes; ++nodeIndex) {
+        std::cout << "F[" << nodeIndex << "] = "
+                  << (treeView.firstChildArray[nodeIndex] == NIL_VALUE ? "nil" : std::to_string(treeView.firstChildArray[nodeIndex]))
+                  << ", N[" << nodeIndex << "] = "
+                  << (treeView.nextSiblingArray[nodeIndex] == NIL_VALUE ? "nil" : std::to_string(treeView.nextSiblingArray[nodeIndex]))
+                  << std::endl;
+    }
+    std::cout << std::endl;
+}
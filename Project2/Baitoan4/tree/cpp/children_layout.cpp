@@ -0,0 +1,159 @@
+#include <vector>
+#include <iostream>
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Structure to represent contiguous (CSR) children layout for tree
+ * @details Children of node v are childNodes[childOffsets[v] .. childOffsets[v + 1]),
+ *          stored in increasing node order. Two flat arrays replace one vector per node.
+ */
+struct ChildrenLayout {
+    std::vector<int> childOffsets;
+    std::vector<int> childNodes;
+    int numberOfNodes;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    ChildrenLayout() : numberOfNodes(0), rootNode(NIL_VALUE) {}
+
+    /**
+     * @brief Constructor with node count
+     * @param nodeCount Number of nodes in the tree
+     */
+    ChildrenLayout(int nodeCount) : numberOfNodes(nodeCount), rootNode(NIL_VALUE) {
+        childOffsets.resize(nodeCount + 1, 0);
+    }
+
+    /**
+     * @brief Number of children of a node
+     * @param nodeIndex Node to query
+     * @return Child count
+     */
+    int childCount(int nodeIndex) const {
+        return childOffsets[nodeIndex + 1] - childOffsets[nodeIndex];
+    }
+};
+
+/**
+ * @brief Build children layout from array of parents by counting sort
+ * @details Pass 1 counts children per parent, pass 2 scatters each node into its parent's slot.
+ *          Scattering in node order keeps children sorted, matching the push_back order used before.
+ * @param parentArray Array of parent pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return ChildrenLayout structure containing the children of every node
+ */
+ChildrenLayout buildChildrenLayoutFromParents(const std::vector<int>& parentArray, int numberOfNodes) {
+    ChildrenLayout childrenLayout(numberOfNodes);
+
+    // Pass 1: count children of every node
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        if (parentArray[nodeIndex] != NIL_VALUE) {
+            childrenLayout.childOffsets[parentArray[nodeIndex] + 1]++;
+        } else {
+            childrenLayout.rootNode = nodeIndex;
+        }
+    }
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        childrenLayout.childOffsets[nodeIndex + 1] += childrenLayout.childOffsets[nodeIndex];
+    }
+
+    // Pass 2: place every node into its parent's slot
+    childrenLayout.childNodes.resize(childrenLayout.childOffsets[numberOfNodes]);
+    std::vector<int> insertPosition(childrenLayout.childOffsets.begin(), childrenLayout.childOffsets.end() - 1);
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        if (parentArray[nodeIndex] != NIL_VALUE) {
+            childrenLayout.childNodes[insertPosition[parentArray[nodeIndex]]++] = nodeIndex;
+        }
+    }
+
+    return childrenLayout;
+}
+
+/**
+ * @brief Build children layout from first-child next-sibling arrays
+ * @details Pass 1 measures every sibling chain, pass 2 copies the chains in sibling order.
+ *          Each node is visited once per pass, so the total work is O(n).
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return ChildrenLayout structure containing the children of every node
+ */
+ChildrenLayout buildChildrenLayoutFromFirstChildNextSibling(const std::vector<int>& firstChildArray,
+                                                          const std::vector<int>& nextSiblingArray,
+                                                          int numberOfNodes) {
+    ChildrenLayout childrenLayout(numberOfNodes);
+    std::vector<bool> isChild(numberOfNodes, false);
+
+    // Pass 1: measure the sibling chain hanging off every node
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        int currentChild = firstChildArray[nodeIndex];
+        while (currentChild != NIL_VALUE) {
+            isChild[currentChild] = true;
+            childrenLayout.childOffsets[nodeIndex + 1]++;
+            currentChild = nextSiblingArray[currentChild];
+        }
+    }
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        childrenLayout.childOffsets[nodeIndex + 1] += childrenLayout.childOffsets[nodeIndex];
+    }
+
+    // Pass 2: copy every chain into its contiguous slot
+    childrenLayout.childNodes.resize(childrenLayout.childOffsets[numberOfNodes]);
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        int writePosition = childrenLayout.childOffsets[nodeIndex];
+        int currentChild = firstChildArray[nodeIndex];
+        while (currentChild != NIL_VALUE) {
+            childrenLayout.childNodes[writePosition++] = currentChild;
+            currentChild = nextSiblingArray[currentChild];
+        }
+    }
+
+    // Find root node (node that is not a child of any other node)
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        if (!isChild[nodeIndex]) {
+            childrenLayout.rootNode = nodeIndex;
+            break;
+        }
+    }
+
+    return childrenLayout;
+}
+
+/**
+ * @brief Build children layout from graph-based adjacency lists
+ * @param adjacencyData Graph adjacency list representation
+ * @param numberOfNodes Number of nodes in the tree
+ * @return ChildrenLayout structure containing the children of every node
+ */
+ChildrenLayout buildChildrenLayoutFromGraphBased(const std::vector<std::vector<int>>& adjacencyData,
+                                                int numberOfNodes) {
+    ChildrenLayout childrenLayout(numberOfNodes);
+    std::vector<bool> isChild(numberOfNodes, false);
+
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        childrenLayout.childOffsets[nodeIndex + 1] = childrenLayout.childOffsets[nodeIndex]
+                                                   + static_cast<int>(adjacencyData[nodeIndex].size());
+    }
+
+    childrenLayout.childNodes.resize(childrenLayout.childOffsets[numberOfNodes]);
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        int writePosition = childrenLayout.childOffsets[nodeIndex];
+        for (int childNode : adjacencyData[nodeIndex]) {
+            childrenLayout.childNodes[writePosition++] = childNode;
+            isChild[childNode] = true;
+        }
+    }
+
+    // Find root node (node that is not a child of any other node)
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        if (!isChild[nodeIndex]) {
+            childrenLayout.rootNode = nodeIndex;
+            break;
+        }
+    }
+
+    return childrenLayout;
+}
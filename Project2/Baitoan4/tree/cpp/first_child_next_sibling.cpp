@@ -120,31 +120,22 @@ void writeFirstChildNextSiblingToFile(const FirstChildNextSibling& fcnsTree, con
 }
 
 /**
- * @brief Convert array of parents to first-child next-sibling representation
- * @param parentArray Array of parent pointers
- * @param numberOfNodes Number of nodes in the tree
+ * @brief Convert children layout to first-child next-sibling representation
+ * @param childrenLayout Contiguous children layout of the tree
  * @return FirstChildNextSibling structure containing the converted data
  */
-FirstChildNextSibling convertArrayParentsToFirstChildNextSibling(const std::vector<int>& parentArray, 
-                                                                int numberOfNodes) {
-    FirstChildNextSibling fcnsTree(numberOfNodes);
-    
-    // Build children lists for each node
-    std::vector<std::vector<int>> childrenLists(numberOfNodes);
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        if (parentArray[nodeIndex] != NIL_VALUE) {
-            childrenLists[parentArray[nodeIndex]].push_back(nodeIndex);
-        } else {
-            fcnsTree.rootNode = nodeIndex;
-        }
-    }
-    
-    // Convert children lists to first-child next-sibling representation
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        if (!childrenLists[nodeIndex].empty()) {
-            fcnsTree.firstChildArray[nodeIndex] = childrenLists[nodeIndex][0];
-            for (int childIndex = 0; childIndex + 1 < static_cast<int>(childrenLists[nodeIndex].size()); ++childIndex) {
-                fcnsTree.nextSiblingArray[childrenLists[nodeIndex][childIndex]] = childrenLists[nodeIndex][childIndex + 1];
+FirstChildNextSibling convertChildrenLayoutToFirstChildNextSibling(const ChildrenLayout& childrenLayout) {
+    FirstChildNextSibling fcnsTree(childrenLayout.numberOfNodes);
+    fcnsTree.rootNode = childrenLayout.rootNode;
+    
+    // Each contiguous children slot becomes one sibling chain
+    for (int nodeIndex = 0; nodeIndex < childrenLayout.numberOfNodes; ++nodeIndex) {
+        int childBegin = childrenLayout.childOffsets[nodeIndex];
+        int childEnd = childrenLayout.childOffsets[nodeIndex + 1];
+        if (childBegin < childEnd) {
+            fcnsTree.firstChildArray[nodeIndex] = childrenLayout.childNodes[childBegin];
+            for (int position = childBegin; position + 1 < childEnd; ++position) {
+                fcnsTree.nextSiblingArray[childrenLayout.childNodes[position]] = childrenLayout.childNodes[position + 1];
             }
         }
     }
@@ -152,6 +143,19 @@ FirstChildNextSibling convertArrayParentsToFirstChildNextSibling(const std::vect
     return fcnsTree;
 }
 
+/**
+ * @brief Convert array of parents to first-child next-sibling representation
+ * @param parentArray Array of parent pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return FirstChildNextSibling structure containing the converted data
+ */
+FirstChildNextSibling convertArrayParentsToFirstChildNextSibling(const std::vector<int>& parentArray, 
+                                                                int numberOfNodes) {
+    // Build contiguous children layout in two linear passes instead of one vector per node
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromParents(parentArray, numberOfNodes);
+    return convertChildrenLayoutToFirstChildNextSibling(childrenLayout);
+}
+
 /**
  * @brief Convert graph-based representation to first-child next-sibling
  * @param adjacencyData Graph adjacency list representation
@@ -131,6 +131,25 @@ void writeGraphBasedRepresentationToFile(const GraphBasedRepresentation& graphTr
     outputFile.close();
 }
 
+/**
+ * @brief Convert children layout to graph-based representation
+ * @details Every adjacency vector is allocated once at its exact final size
+ * @param childrenLayout Contiguous children layout of the tree
+ * @return GraphBasedRepresentation structure containing the converted data
+ */
+GraphBasedRepresentation convertChildrenLayoutToGraphBased(const ChildrenLayout& childrenLayout) {
+    GraphBasedRepresentation graphTree(childrenLayout.numberOfNodes);
+    graphTree.rootNode = childrenLayout.rootNode;
+    
+    for (int nodeIndex = 0; nodeIndex < childrenLayout.numberOfNodes; ++nodeIndex) {
+        graphTree.adjacencyData[nodeIndex].assign(
+            childrenLayout.childNodes.begin() + childrenLayout.childOffsets[nodeIndex],
+            childrenLayout.childNodes.begin() + childrenLayout.childOffsets[nodeIndex + 1]);
+    }
+    
+    return graphTree;
+}
+
 /**
  * @brief Convert array of parents to graph-based representation
  * @param parentArray Array of parent pointers
@@ -139,17 +158,8 @@ void writeGraphBasedRepresentationToFile(const GraphBasedRepresentation& graphTr
  */
 GraphBasedRepresentation convertArrayParentsToGraphBased(const std::vector<int>& parentArray, 
                                                         int numberOfNodes) {
-    GraphBasedRepresentation graphTree(numberOfNodes);
-    
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        if (parentArray[nodeIndex] != NIL_VALUE) {
-            graphTree.adjacencyData[parentArray[nodeIndex]].push_back(nodeIndex);
-        } else {
-            graphTree.rootNode = nodeIndex;
-        }
-    }
-    
-    return graphTree;
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromParents(parentArray, numberOfNodes);
+    return convertChildrenLayoutToGraphBased(childrenLayout);
 }
 
 /**
@@ -162,40 +172,6 @@ GraphBasedRepresentation convertArrayParentsToGraphBased(const std::vector<int>&
 GraphBasedRepresentation convertFirstChildNextSiblingToGraphBased(const std::vector<int>& firstChildArray, 
                                                                  const std::vector<int>& nextSiblingArray, 
                                                                  int numberOfNodes) {
-    GraphBasedRepresentation graphTree(numberOfNodes);
-    
-    // Find root node (node that is not a child of any other node)
-    std::vector<bool> isChild(numberOfNodes, false);
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        if (firstChildArray[nodeIndex] != NIL_VALUE) {
-            // Mark first child as a child
-            isChild[firstChildArray[nodeIndex]] = true;
-            
-            // Mark all siblings in the chain as children
-            int currentSibling = firstChildArray[nodeIndex];
-            while (currentSibling != NIL_VALUE) {
-                isChild[currentSibling] = true;
-                currentSibling = nextSiblingArray[currentSibling];
-            }
-        }
-    }
-    
-    // Find root node
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        if (!isChild[nodeIndex]) {
-            graphTree.rootNode = nodeIndex;
-            break;
-        }
-    }
-    
-    // Convert first-child next-sibling to adjacency list
-    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
-        int currentChild = firstChildArray[nodeIndex];
-        while (currentChild != NIL_VALUE) {
-            graphTree.adjacencyData[nodeIndex].push_back(currentChild);
-            currentChild = nextSiblingArray[currentChild];
-        }
-    }
-    
-    return graphTree;
-} 
\ No newline at end of file
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromFirstChildNextSibling(firstChildArray, nextSiblingArray, numberOfNodes);
+    return convertChildrenLayoutToGraphBased(childrenLayout);
+}
\ No newline at end of file
@@ -1,8 +1,18 @@
 #include "array_of_parents.cpp"
+#include "children_layout.cpp"
 #include "first_child_next_sibling.cpp"
 #include "graph_based_representation.cpp"
+#include "preorder_interval.cpp"
+#include "parallel_for.cpp"
+#include "ancestor_queries.cpp"
+#include "parallel_tree_conversion.cpp"
+#include "binary_tree_file.cpp"
+#include "tree_relayout.cpp"
 #include <iostream>
 #include <fstream>
+#include <cstdio>
+#include <random>
+#include <chrono>
 
 /**
  * @brief Demonstrate all tree representation conversions using input.txt
@@ -83,11 +93,229 @@ void executeTreeConversionTests() {
         std::cout << "Round-trip verification: Original root = " << testArray.rootNode 
                   << ", FCNS->Array root = " << backToArray.rootNode 
                   << ", Graph->Array root = " << backToArray2.rootNode << std::endl;
+        
+        // Verify parallel list-ranking conversions against the serial ones
+        ArrayOfParents parallelArray = convertFirstChildNextSiblingToArrayParentsParallel(testFCNS.firstChildArray, testFCNS.nextSiblingArray, testFCNS.numberOfNodes);
+        GraphBasedRepresentation parallelGraph = convertFirstChildNextSiblingToGraphBasedParallel(testFCNS.firstChildArray, testFCNS.nextSiblingArray, testFCNS.numberOfNodes);
+        std::cout << "Parallel FCNS->Array matches serial: " << (parallelArray.parentArray == backToArray.parentArray ? "yes" : "no")
+                  << ", parallel FCNS->Graph matches serial: " << (parallelGraph.adjacencyData == testGraph.adjacencyData ? "yes" : "no") << std::endl;
     } else {
         std::cout << "Failed to load tree from input.txt" << std::endl;
     }
 }
 
+/**
+ * @brief Demonstrate preorder-interval representation and O(1) subtree queries using input.txt
+ */
+void demonstratePreorderIntervalQueries() {
+    std::cout << "=== Preorder-Interval Representation Demo ===" << std::endl;
+    
+    ArrayOfParents arrayParents = readArrayOfParentsFromFile("input.txt");
+    if (arrayParents.numberOfNodes == 0) {
+        std::cerr << "Error: Failed to read input.txt" << std::endl;
+        return;
+    }
+    
+    FirstChildNextSibling fcnsTree = convertArrayParentsToFirstChildNextSibling(arrayParents.parentArray, arrayParents.numberOfNodes);
+    GraphBasedRepresentation graphTree = convertArrayParentsToGraphBased(arrayParents.parentArray, arrayParents.numberOfNodes);
+    
+    std::cout << "--- Conversion 7: Array of Parents to Preorder-Interval ---" << std::endl;
+    PreorderIntervalTree intervalFromArray = convertArrayParentsToPreorderInterval(arrayParents.parentArray, arrayParents.numberOfNodes);
+    displayPreorderIntervalTree(intervalFromArray);
+    
+    PreorderIntervalTree intervalFromFCNS = convertFirstChildNextSiblingToPreorderInterval(fcnsTree.firstChildArray, fcnsTree.nextSiblingArray, fcnsTree.numberOfNodes);
+    PreorderIntervalTree intervalFromGraph = convertGraphBasedToPreorderInterval(graphTree.adjacencyData, graphTree.numberOfNodes);
+    std::cout << "FCNS and Graph-Based conversions agree: "
+              << (intervalFromFCNS.preorderIndex == intervalFromArray.preorderIndex &&
+                  intervalFromGraph.preorderIndex == intervalFromArray.preorderIndex ? "yes" : "no") << std::endl;
+    
+    // Sample ancestor queries: every node against the root's first child
+    int queryAncestor = fcnsTree.firstChildArray[arrayParents.rootNode];
+    if (queryAncestor != NIL_VALUE) {
+        std::cout << "Subtree of node " << queryAncestor << " has " << getSubtreeSize(intervalFromArray, queryAncestor) << " nodes:";
+        for (int nodeIndex = 0; nodeIndex < arrayParents.numberOfNodes; ++nodeIndex) {
+            if (isInSubtree(intervalFromArray, queryAncestor, nodeIndex)) {
+                std::cout << " " << nodeIndex;
+            }
+        }
+        std::cout << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Demonstrate LCA and k-th ancestor query engine using input.txt
+ */
+void demonstrateAncestorQueries() {
+    std::cout << "=== Ancestor Query Engine Demo ===" << std::endl;
+    
+    ArrayOfParents arrayParents = readArrayOfParentsFromFile("input.txt");
+    if (arrayParents.numberOfNodes == 0) {
+        std::cerr << "Error: Failed to read input.txt" << std::endl;
+        return;
+    }
+    
+    EulerTourLcaTable lcaTable = buildEulerTourLcaTable(arrayParents.parentArray, arrayParents.numberOfNodes);
+    BinaryLiftingTable liftingTable = buildBinaryLiftingTable(arrayParents.parentArray, arrayParents.numberOfNodes);
+    std::cout << "Sparse table levels: " << lcaTable.levelCount
+              << ", binary lifting levels: " << liftingTable.levelCount << std::endl;
+    
+    // Batch of LCA queries over mirrored node pairs
+    std::vector<std::pair<int, int>> lcaQueries;
+    for (int nodeIndex = 0; nodeIndex + 1 < arrayParents.numberOfNodes; nodeIndex += 3) {
+        lcaQueries.push_back({nodeIndex, arrayParents.numberOfNodes - 1 - nodeIndex});
+    }
+    std::vector<int> lcaAnswers = answerLowestCommonAncestorQueries(lcaTable, lcaQueries);
+    for (int queryIndex = 0; queryIndex < static_cast<int>(lcaQueries.size()); ++queryIndex) {
+        std::cout << "LCA(" << lcaQueries[queryIndex].first << ", " << lcaQueries[queryIndex].second << ") = "
+                  << lcaAnswers[queryIndex] << " (binary lifting: "
+                  << findLowestCommonAncestorByLifting(liftingTable, lcaQueries[queryIndex].first, lcaQueries[queryIndex].second)
+                  << ")" << std::endl;
+    }
+    
+    // Batch of k-th ancestor queries from the deepest-numbered node
+    std::vector<std::pair<int, int>> ancestorQueries;
+    for (int ancestorDistance = 0; ancestorDistance <= 4; ++ancestorDistance) {
+        ancestorQueries.push_back({arrayParents.numberOfNodes - 1, ancestorDistance});
+    }
+    std::vector<int> ancestorAnswers = answerKthAncestorQueries(liftingTable, ancestorQueries);
+    for (int queryIndex = 0; queryIndex < static_cast<int>(ancestorQueries.size()); ++queryIndex) {
+        std::cout << ancestorQueries[queryIndex].second << "-th ancestor of " << ancestorQueries[queryIndex].first << " = "
+                  << (ancestorAnswers[queryIndex] == NIL_VALUE ? "nil" : std::to_string(ancestorAnswers[queryIndex])) << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Demonstrate binary tree file round trip through zero-copy mapped views using input.txt
+ */
+void demonstrateBinaryTreeFiles() {
+    std::cout << "=== Binary Tree File Demo ===" << std::endl;
+    const std::string PARENTS_BINARY_FILE = "tree_parents.bin";
+    const std::string FCNS_BINARY_FILE = "tree_fcns.bin";
+    
+    ArrayOfParents arrayParents = readArrayOfParentsFromFile("input.txt");
+    if (arrayParents.numberOfNodes == 0) {
+        std::cerr << "Error: Failed to read input.txt" << std::endl;
+        return;
+    }
+    FirstChildNextSibling fcnsTree = convertArrayParentsToFirstChildNextSibling(arrayParents.parentArray, arrayParents.numberOfNodes);
+    
+    writeArrayOfParentsToBinaryFile(arrayParents, PARENTS_BINARY_FILE);
+    writeFirstChildNextSiblingToBinaryFile(fcnsTree, FCNS_BINARY_FILE);
+    
+    {
+        MappedArrayOfParents mappedParents = readArrayOfParentsFromBinaryFile(PARENTS_BINARY_FILE);
+        displayArrayOfParentsView(mappedParents.treeView);
+        ArrayOfParents copiedParents = convertArrayOfParentsViewToArrayParents(mappedParents.treeView);
+        std::cout << "Mapped parents match text input: " << (copiedParents.parentArray == arrayParents.parentArray ? "yes" : "no") << std::endl;
+        
+        MappedFirstChildNextSibling mappedFCNS = readFirstChildNextSiblingFromBinaryFile(FCNS_BINARY_FILE);
+        FirstChildNextSibling copiedFCNS = convertFirstChildNextSiblingViewToFirstChildNextSibling(mappedFCNS.treeView);
+        std::cout << "Mapped first-child next-sibling matches conversion: "
+                  << (copiedFCNS.firstChildArray == fcnsTree.firstChildArray && copiedFCNS.nextSiblingArray == fcnsTree.nextSiblingArray ? "yes" : "no")
+                  << std::endl;
+    } // Mappings are released here, before the files are removed
+    
+    std::remove(PARENTS_BINARY_FILE.c_str());
+    std::remove(FCNS_BINARY_FILE.c_str());
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Number of nodes in the generated tree used by the relayout traversal benchmark
+ */
+const int RELAYOUT_BENCHMARK_NODE_COUNT = 10000000;
+
+/**
+ * @brief Generate a random recursive tree whose node ids are shuffled
+ * @details Each node picks a uniformly random earlier node as parent, then all ids are permuted,
+ *          so the ids carry no locality, as in arbitrary input order
+ * @param numberOfNodes Number of nodes to generate
+ * @param randomSeed Seed of the generator
+ * @return ArrayOfParents structure containing the generated tree
+ */
+ArrayOfParents generateShuffledRandomTree(int numberOfNodes, unsigned int randomSeed) {
+    std::mt19937 randomGenerator(randomSeed);
+    std::vector<int> shuffledIds(numberOfNodes);
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        shuffledIds[nodeIndex] = nodeIndex;
+    }
+    std::shuffle(shuffledIds.begin(), shuffledIds.end(), randomGenerator);
+
+    ArrayOfParents randomTree(numberOfNodes);
+    if (numberOfNodes == 0) {
+        return randomTree;
+    }
+    randomTree.rootNode = shuffledIds[0];
+    for (int nodeIndex = 1; nodeIndex < numberOfNodes; ++nodeIndex) {
+        std::uniform_int_distribution<int> parentDistribution(0, nodeIndex - 1);
+        randomTree.parentArray[shuffledIds[nodeIndex]] = shuffledIds[parentDistribution(randomGenerator)];
+    }
+    return randomTree;
+}
+
+/**
+ * @brief Demonstrate cache-friendly tree relayout on input.txt and benchmark chain walks on a large tree
+ */
+void demonstrateTreeRelayout() {
+    std::cout << "=== Tree Relayout Demo ===" << std::endl;
+    const TreeLayoutOrder LAYOUT_ORDERS[] = {TreeLayoutOrder::LevelOrder, TreeLayoutOrder::DepthFirst, TreeLayoutOrder::VanEmdeBoas};
+    
+    ArrayOfParents arrayParents = readArrayOfParentsFromFile("input.txt");
+    if (arrayParents.numberOfNodes == 0) {
+        std::cerr << "Error: Failed to read input.txt" << std::endl;
+        return;
+    }
+    FirstChildNextSibling fcnsTree = convertArrayParentsToFirstChildNextSibling(arrayParents.parentArray, arrayParents.numberOfNodes);
+    long long inputDepthSum = sumNodeDepthsByChainWalk(fcnsTree);
+    
+    for (TreeLayoutOrder layoutOrder : LAYOUT_ORDERS) {
+        RelaidOutTree relaidOutTree = relayoutTree(arrayParents, layoutOrder);
+        std::cout << "Nodes in " << getTreeLayoutOrderName(layoutOrder) << " (new id -> original id):";
+        for (int newId = 0; newId < arrayParents.numberOfNodes; ++newId) {
+            std::cout << " " << relaidOutTree.originalIdOfNode[newId];
+        }
+        std::cout << std::endl;
+        
+        // Mapping the relaid-out parents back through the permutation must give the input tree
+        ArrayOfParents restoredParents = relayoutArrayOfParents(relaidOutTree.arrayParents, relaidOutTree.originalIdOfNode);
+        GraphBasedRepresentation graphFromFCNS = convertFirstChildNextSiblingToGraphBased(relaidOutTree.fcnsTree.firstChildArray,
+                                                                                          relaidOutTree.fcnsTree.nextSiblingArray,
+                                                                                          relaidOutTree.fcnsTree.numberOfNodes);
+        std::cout << "Round trip matches input: " << (restoredParents.parentArray == arrayParents.parentArray ? "yes" : "no")
+                  << ", representations agree: " << (graphFromFCNS.adjacencyData == relaidOutTree.graphTree.adjacencyData ? "yes" : "no")
+                  << ", depth sum preserved: " << (sumNodeDepthsByChainWalk(relaidOutTree.fcnsTree) == inputDepthSum ? "yes" : "no")
+                  << std::endl;
+    }
+    
+    // Benchmark: build only the FCNS form, since chain walks are what the layout is meant to speed up
+    std::cout << "--- Chain walk benchmark on " << RELAYOUT_BENCHMARK_NODE_COUNT << " nodes ---" << std::endl;
+    ArrayOfParents benchmarkTree = generateShuffledRandomTree(RELAYOUT_BENCHMARK_NODE_COUNT, 12345u);
+    ChildrenLayout benchmarkLayout = buildChildrenLayoutFromParents(benchmarkTree.parentArray, benchmarkTree.numberOfNodes);
+    FirstChildNextSibling shuffledFCNS = convertChildrenLayoutToFirstChildNextSibling(benchmarkLayout);
+    
+    auto walkStart = std::chrono::steady_clock::now();
+    long long shuffledDepthSum = sumNodeDepthsByChainWalk(shuffledFCNS);
+    double shuffledMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - walkStart).count();
+    std::cout << "input order: " << shuffledMilliseconds << " ms" << std::endl;
+    
+    for (TreeLayoutOrder layoutOrder : LAYOUT_ORDERS) {
+        auto relayoutStart = std::chrono::steady_clock::now();
+        std::vector<int> newIdOfNode = computeTreeLayoutPermutation(benchmarkLayout, layoutOrder);
+        FirstChildNextSibling relaidOutFCNS = relayoutFirstChildNextSibling(shuffledFCNS, newIdOfNode);
+        double relayoutMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - relayoutStart).count();
+        
+        walkStart = std::chrono::steady_clock::now();
+        long long relaidOutDepthSum = sumNodeDepthsByChainWalk(relaidOutFCNS);
+        double walkMilliseconds = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - walkStart).count();
+        std::cout << getTreeLayoutOrderName(layoutOrder) << ": " << walkMilliseconds << " ms (relayout "
+                  << relayoutMilliseconds << " ms, speedup " << shuffledMilliseconds / walkMilliseconds << "x, "
+                  << (relaidOutDepthSum == shuffledDepthSum ? "same" : "DIFFERENT") << " depth sum)" << std::endl;
+    }
+    std::cout << std::endl;
+}
+
 /**
  * @brief Main function to demonstrate tree representation conversions
  * @return Exit status
@@ -105,6 +333,19 @@ int main() {
         
         // Demonstrate all conversions
         demonstrateTreeRepresentationConversions();
+        std::cout << std::endl;
+        
+        // Demonstrate preorder-interval subtree queries
+        demonstratePreorderIntervalQueries();
+        
+        // Demonstrate batched LCA and k-th ancestor queries
+        demonstrateAncestorQueries();
+        
+        // Demonstrate binary tree files loaded through memory mapping
+        demonstrateBinaryTreeFiles();
+        
+        // Demonstrate cache-friendly relayout and the chain walk benchmark
+        demonstrateTreeRelayout();
         
     } catch (const std::exception& error) {
         std::cerr << "Error occurred during execution: " << error.what() << std::endl;
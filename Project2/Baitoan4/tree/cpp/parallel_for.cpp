@@ -0,0 +1,49 @@
+#include <vector>
+#include <thread>
+#include <algorithm>
+
+/**
+ * @brief Smallest number of items worth handing to a separate thread
+ */
+const int PARALLEL_MIN_ITEMS_PER_WORKER = 1 << 16;
+
+/**
+ * @brief Get number of worker threads available for parallel tree builds
+ * @return Hardware thread count, at least 1
+ */
+int getParallelWorkerCount() {
+    unsigned int hardwareThreads = std::thread::hardware_concurrency();
+    return hardwareThreads == 0 ? 1 : static_cast<int>(hardwareThreads);
+}
+
+/**
+ * @brief Split [0, itemCount) into contiguous blocks and process them on separate threads
+ * @details Small ranges run inline on the calling thread. Build with -pthread.
+ * @param itemCount Number of items to process
+ * @param processRange Called as processRange(begin, end) once per block
+ * @param minItemsPerWorker Fewest items given to one thread; pass 1 when every item is already a large unit of work
+ */
+template <typename RangeBody>
+void runParallelForRange(int itemCount, RangeBody processRange, int minItemsPerWorker = PARALLEL_MIN_ITEMS_PER_WORKER) {
+    int workerCount = std::min(getParallelWorkerCount(),
+                               std::max(1, itemCount / std::max(1, minItemsPerWorker)));
+    if (workerCount <= 1) {
+        processRange(0, itemCount);
+        return;
+    }
+
+    std::vector<std::thread> workerThreads;
+    workerThreads.reserve(workerCount);
+    int blockSize = (itemCount + workerCount - 1) / workerCount;
+    for (int workerIndex = 0; workerIndex < workerCount; ++workerIndex) {
+        int blockBegin = workerIndex * blockSize;
+        int blockEnd = std::min(itemCount, blockBegin + blockSize);
+        if (blockBegin >= blockEnd) {
+            break;
+        }
+        workerThreads.emplace_back(processRange, blockBegin, blockEnd);
+    }
+    for (std::thread& workerThread : workerThreads) {
+        workerThread.join();
+    }
+}
@@ -0,0 +1,168 @@
+#include <vector>
+#include <atomic>
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Rank every sibling chain in parallel by pointer jumping (list ranking)
+ * @details Each node jumps towards the head of its sibling chain, doubling the distance every round,
+ *          so a chain of length L is resolved in O(log L) parallel rounds instead of an L-step pointer chase.
+ *          The parent of a node is then the owner of its chain head (the node whose first child is that head).
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @param parentArray Output parent of every node (NIL_VALUE for the root)
+ * @param siblingRank Output position of every node inside its sibling chain (0 for first children)
+ */
+void rankSiblingChainsParallel(const std::vector<int>& firstChildArray,
+                               const std::vector<int>& nextSiblingArray,
+                               int numberOfNodes,
+                               std::vector<int>& parentArray,
+                               std::vector<int>& siblingRank) {
+    std::vector<int> chainOwner(numberOfNodes, NIL_VALUE);
+    std::vector<int> jumpTarget(numberOfNodes);
+    std::vector<int> nextJumpTarget(numberOfNodes);
+    std::vector<int> nextSiblingRank(numberOfNodes);
+    siblingRank.assign(numberOfNodes, 0);
+    parentArray.assign(numberOfNodes, NIL_VALUE);
+
+    // Every node starts pointing at itself, chain heads remember which node owns them
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            jumpTarget[nodeIndex] = nodeIndex;
+            if (firstChildArray[nodeIndex] != NIL_VALUE) {
+                chainOwner[firstChildArray[nodeIndex]] = nodeIndex;
+            }
+        }
+    });
+
+    // Reverse the sibling links: each node points at its previous sibling at distance 1
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            int siblingNode = nextSiblingArray[nodeIndex];
+            if (siblingNode != NIL_VALUE) {
+                jumpTarget[siblingNode] = nodeIndex;
+                siblingRank[siblingNode] = 1;
+            }
+        }
+    });
+
+    // Pointer jumping until every node points at its chain head
+    std::atomic<bool> anyJumpChanged(true);
+    while (anyJumpChanged.load()) {
+        anyJumpChanged.store(false);
+        runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+            bool localChanged = false;
+            for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+                int currentTarget = jumpTarget[nodeIndex];
+                nextSiblingRank[nodeIndex] = siblingRank[nodeIndex] + siblingRank[currentTarget];
+                nextJumpTarget[nodeIndex] = jumpTarget[currentTarget];
+                localChanged = localChanged || (nextJumpTarget[nodeIndex] != currentTarget);
+            }
+            if (localChanged) {
+                anyJumpChanged.store(true);
+            }
+        });
+        jumpTarget.swap(nextJumpTarget);
+        siblingRank.swap(nextSiblingRank);
+    }
+
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            parentArray[nodeIndex] = chainOwner[jumpTarget[nodeIndex]];
+        }
+    });
+}
+
+/**
+ * @brief Convert first-child next-sibling to array of parents using parallel list ranking
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return ArrayOfParents structure containing the converted data
+ */
+ArrayOfParents convertFirstChildNextSiblingToArrayParentsParallel(const std::vector<int>& firstChildArray,
+                                                                 const std::vector<int>& nextSiblingArray,
+                                                                 int numberOfNodes) {
+    ArrayOfParents arrayParents(numberOfNodes);
+    std::vector<int> siblingRank;
+    rankSiblingChainsParallel(firstChildArray, nextSiblingArray, numberOfNodes, arrayParents.parentArray, siblingRank);
+
+    // Find root node
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        if (arrayParents.parentArray[nodeIndex] == NIL_VALUE) {
+            arrayParents.rootNode = nodeIndex;
+            break;
+        }
+    }
+
+    return arrayParents;
+}
+
+/**
+ * @brief Build children layout from first-child next-sibling using parallel list ranking
+ * @details Sibling ranks give every child its slot directly, so the scatter needs no per-parent cursor
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return ChildrenLayout structure containing the children of every node
+ */
+ChildrenLayout buildChildrenLayoutFromFirstChildNextSiblingParallel(const std::vector<int>& firstChildArray,
+                                                                  const std::vector<int>& nextSiblingArray,
+                                                                  int numberOfNodes) {
+    ChildrenLayout childrenLayout(numberOfNodes);
+    std::vector<int> parentArray;
+    std::vector<int> siblingRank;
+    rankSiblingChainsParallel(firstChildArray, nextSiblingArray, numberOfNodes, parentArray, siblingRank);
+
+    // The last sibling of each chain knows how many children its parent has
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            if (parentArray[nodeIndex] != NIL_VALUE && nextSiblingArray[nodeIndex] == NIL_VALUE) {
+                childrenLayout.childOffsets[parentArray[nodeIndex] + 1] = siblingRank[nodeIndex] + 1;
+            }
+        }
+    });
+    for (int nodeIndex = 0; nodeIndex < numberOfNodes; ++nodeIndex) {
+        childrenLayout.childOffsets[nodeIndex + 1] += childrenLayout.childOffsets[nodeIndex];
+        if (childrenLayout.rootNode == NIL_VALUE && parentArray[nodeIndex] == NIL_VALUE) {
+            childrenLayout.rootNode = nodeIndex;
+        }
+    }
+
+    childrenLayout.childNodes.resize(childrenLayout.childOffsets[numberOfNodes]);
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            if (parentArray[nodeIndex] != NIL_VALUE) {
+                childrenLayout.childNodes[childrenLayout.childOffsets[parentArray[nodeIndex]] + siblingRank[nodeIndex]] = nodeIndex;
+            }
+        }
+    });
+
+    return childrenLayout;
+}
+
+/**
+ * @brief Convert first-child next-sibling to graph-based representation using parallel list ranking
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return GraphBasedRepresentation structure containing the converted data
+ */
+GraphBasedRepresentation convertFirstChildNextSiblingToGraphBasedParallel(const std::vector<int>& firstChildArray,
+                                                                         const std::vector<int>& nextSiblingArray,
+                                                                         int numberOfNodes) {
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromFirstChildNextSiblingParallel(firstChildArray, nextSiblingArray, numberOfNodes);
+
+    GraphBasedRepresentation graphTree(numberOfNodes);
+    graphTree.rootNode = childrenLayout.rootNode;
+    runParallelForRange(numberOfNodes, [&](int rangeBegin, int rangeEnd) {
+        for (int nodeIndex = rangeBegin; nodeIndex < rangeEnd; ++nodeIndex) {
+            graphTree.adjacencyData[nodeIndex].assign(
+                childrenLayout.childNodes.begin() + childrenLayout.childOffsets[nodeIndex],
+                childrenLayout.childNodes.begin() + childrenLayout.childOffsets[nodeIndex + 1]);
+        }
+    });
+
+    return graphTree;
+}
@@ -0,0 +1,184 @@
+#include <vector>
+#include <iostream>
+#include <fstream>
+#include <string>
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Structure to represent preorder-interval (Euler tour) representation for tree
+ * @details Node u lies in the subtree of v exactly when
+ *          preorderIndex[v] <= preorderIndex[u] < preorderIndex[v] + subtreeSize[v],
+ *          so ancestor tests and subtree sizes are answered in O(1)
+ */
+struct PreorderIntervalTree {
+    std::vector<int> preorderIndex;
+    std::vector<int> postorderIndex;
+    std::vector<int> subtreeSize;
+    std::vector<int> preorderSequence;
+    int numberOfNodes;
+    int rootNode;
+
+    /**
+     * @brief Default constructor
+     */
+    PreorderIntervalTree() : numberOfNodes(0), rootNode(NIL_VALUE) {}
+
+    /**
+     * @brief Constructor with node count
+     * @param nodeCount Number of nodes in the tree
+     */
+    PreorderIntervalTree(int nodeCount) : numberOfNodes(nodeCount), rootNode(NIL_VALUE) {
+        preorderIndex.resize(nodeCount, NIL_VALUE);
+        postorderIndex.resize(nodeCount, NIL_VALUE);
+        subtreeSize.resize(nodeCount, 0);
+        preorderSequence.reserve(nodeCount);
+    }
+};
+
+/**
+ * @brief Check whether one node lies in the subtree of another
+ * @param intervalTree The preorder-interval representation
+ * @param ancestorNode Candidate ancestor (a node is its own ancestor)
+ * @param descendantNode Candidate descendant
+ * @return True if descendantNode is in the subtree rooted at ancestorNode
+ */
+bool isInSubtree(const PreorderIntervalTree& intervalTree, int ancestorNode, int descendantNode) {
+    int ancestorEntry = intervalTree.preorderIndex[ancestorNode];
+    int descendantEntry = intervalTree.preorderIndex[descendantNode];
+    if (ancestorEntry == NIL_VALUE || descendantEntry == NIL_VALUE) {
+        return false;
+    }
+    return ancestorEntry <= descendantEntry && descendantEntry < ancestorEntry + intervalTree.subtreeSize[ancestorNode];
+}
+
+/**
+ * @brief Get the number of nodes in the subtree rooted at a node
+ * @param intervalTree The preorder-interval representation
+ * @param nodeIndex Subtree root
+ * @return Subtree size including the node itself
+ */
+int getSubtreeSize(const PreorderIntervalTree& intervalTree, int nodeIndex) {
+    return intervalTree.subtreeSize[nodeIndex];
+}
+
+/**
+ * @brief Convert children layout to preorder-interval representation
+ * @details Iterative DFS with an explicit stack, so deep trees cannot overflow the call stack
+ * @param childrenLayout Contiguous children layout of the tree
+ * @return PreorderIntervalTree structure containing the converted data
+ */
+PreorderIntervalTree convertChildrenLayoutToPreorderInterval(const ChildrenLayout& childrenLayout) {
+    PreorderIntervalTree intervalTree(childrenLayout.numberOfNodes);
+    intervalTree.rootNode = childrenLayout.rootNode;
+    if (childrenLayout.rootNode == NIL_VALUE) {
+        return intervalTree;
+    }
+
+    // nextChildPosition[v] is the next slot of v's children still to be visited
+    std::vector<int> nextChildPosition(childrenLayout.childOffsets.begin(), childrenLayout.childOffsets.end() - 1);
+    std::vector<int> traversalStack;
+    int preorderCounter = 0;
+    int postorderCounter = 0;
+
+    traversalStack.push_back(childrenLayout.rootNode);
+    intervalTree.preorderIndex[childrenLayout.rootNode] = preorderCounter++;
+    intervalTree.preorderSequence.push_back(childrenLayout.rootNode);
+
+    while (!traversalStack.empty()) {
+        int currentNode = traversalStack.back();
+        if (nextChildPosition[currentNode] < childrenLayout.childOffsets[currentNode + 1]) {
+            int childNode = childrenLayout.childNodes[nextChildPosition[currentNode]++];
+            intervalTree.preorderIndex[childNode] = preorderCounter++;
+            intervalTree.preorderSequence.push_back(childNode);
+            traversalStack.push_back(childNode);
+        } else {
+            traversalStack.pop_back();
+            intervalTree.postorderIndex[currentNode] = postorderCounter++;
+            intervalTree.subtreeSize[currentNode] = preorderCounter - intervalTree.preorderIndex[currentNode];
+        }
+    }
+
+    return intervalTree;
+}
+
+/**
+ * @brief Convert array of parents to preorder-interval representation
+ * @param parentArray Array of parent pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return PreorderIntervalTree structure containing the converted data
+ */
+PreorderIntervalTree convertArrayParentsToPreorderInterval(const std::vector<int>& parentArray,
+                                                          int numberOfNodes) {
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromParents(parentArray, numberOfNodes);
+    return convertChildrenLayoutToPreorderInterval(childrenLayout);
+}
+
+/**
+ * @brief Convert first-child next-sibling to preorder-interval representation
+ * @param firstChildArray Array of first child pointers
+ * @param nextSiblingArray Array of next sibling pointers
+ * @param numberOfNodes Number of nodes in the tree
+ * @return PreorderIntervalTree structure containing the converted data
+ */
+PreorderIntervalTree convertFirstChildNextSiblingToPreorderInterval(const std::vector<int>& firstChildArray,
+                                                                   const std::vector<int>& nextSiblingArray,
+                                                                   int numberOfNodes) {
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromFirstChildNextSibling(firstChildArray, nextSiblingArray, numberOfNodes);
+    return convertChildrenLayoutToPreorderInterval(childrenLayout);
+}
+
+/**
+ * @brief Convert graph-based representation to preorder-interval representation
+ * @param adjacencyData Graph adjacency list representation
+ * @param numberOfNodes Number of nodes in the tree
+ * @return PreorderIntervalTree structure containing the converted data
+ */
+PreorderIntervalTree convertGraphBasedToPreorderInterval(const std::vector<std::vector<int>>& adjacencyData,
+                                                        int numberOfNodes) {
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromGraphBased(adjacencyData, numberOfNodes);
+    return convertChildrenLayoutToPreorderInterval(childrenLayout);
+}
+
+/**
+ * @brief Display preorder-interval representation to console
+ * @param intervalTree The preorder-interval representation to display
+ */
+void displayPreorderIntervalTree(const PreorderIntervalTree& intervalTree) {
+    std::cout << "=== Preorder-Interval Representation ===" << std::endl;
+    std::cout << "Number of nodes: " << intervalTree.numberOfNodes << std::endl;
+    std::cout << "Root node: " << intervalTree.rootNode << std::endl;
+
+    for (int nodeIndex = 0; nodeIndex < intervalTree.numberOfNodes; ++nodeIndex) {
+        std::cout << "node " << nodeIndex << ": pre = " << intervalTree.preorderIndex[nodeIndex]
+                  << ", post = " << intervalTree.postorderIndex[nodeIndex]
+                  << ", size = " << intervalTree.subtreeSize[nodeIndex] << std::endl;
+    }
+    std::cout << std::endl;
+}
+
+/**
+ * @brief Write preorder-interval representation to output file
+ * @param intervalTree The preorder-interval representation to write
+ * @param fileName Name of output file
+ */
+void writePreorderIntervalTreeToFile(const PreorderIntervalTree& intervalTree, const std::string& fileName) {
+    std::ofstream outputFile(fileName);
+    if (!outputFile.is_open()) {
+        std::cerr << "Error: Cannot create file " << fileName << std::endl;
+        return;
+    }
+
+    outputFile << "=== Preorder-Interval Representation ===" << std::endl;
+    outputFile << "Number of nodes: " << intervalTree.numberOfNodes << std::endl;
+    outputFile << "Root node: " << intervalTree.rootNode << std::endl;
+
+    for (int nodeIndex = 0; nodeIndex < intervalTree.numberOfNodes; ++nodeIndex) {
+        outputFile << "node " << nodeIndex << ": pre = " << intervalTree.preorderIndex[nodeIndex]
+                   << ", post = " << intervalTree.postorderIndex[nodeIndex]
+                   << ", size = " << intervalTree.subtreeSize[nodeIndex] << std::endl;
+    }
+
+    outputFile.flush();
+    outputFile.close();
+}
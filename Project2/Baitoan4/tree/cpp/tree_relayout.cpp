@@ -0,0 +1,288 @@
+#include <vector>
+#include <iostream>
+#include <string>
+#include <algorithm>
+
+extern const int NIL_VALUE; // Use the constant from array_of_parents.cpp
+
+/**
+ * @brief Node order a relayout pass assigns new ids in
+ */
+enum class TreeLayoutOrder {
+    LevelOrder,
+    DepthFirst,
+    VanEmdeBoas
+};
+
+/**
+ * @brief All three tree representations renumbered into one layout, plus the permutation used
+ * @details Node v of the input tree is node newIdOfNode[v] of every relaid-out representation,
+ *          and originalIdOfNode is the inverse permutation
+ */
+struct RelaidOutTree {
+    ArrayOfParents arrayParents;
+    FirstChildNextSibling fcnsTree;
+    GraphBasedRepresentation graphTree;
+    std::vector<int> newIdOfNode;
+    std::vector<int> originalIdOfNode;
+};
+
+/**
+ * @brief Get a printable name of a layout order
+ * @param layoutOrder The layout order
+ * @return Name of the order
+ */
+std::string getTreeLayoutOrderName(TreeLayoutOrder layoutOrder) {
+    switch (layoutOrder) {
+        case TreeLayoutOrder::LevelOrder: return "level order";
+        case TreeLayoutOrder::DepthFirst: return "depth-first";
+        case TreeLayoutOrder::VanEmdeBoas: return "van Emde Boas";
+    }
+    return "unknown";
+}
+
+/**
+ * @brief Compute level-order (BFS) ids, visiting siblings in child order
+ * @param childrenLayout Contiguous children layout of the tree
+ * @param newIdOfNode Receives the new id of every node reachable from the root
+ * @return Number of ids assigned
+ */
+int assignLevelOrderIds(const ChildrenLayout& childrenLayout, std::vector<int>& newIdOfNode) {
+    // The output ids double as the queue: the node with id k is nodeQueue[k]
+    std::vector<int> nodeQueue;
+    nodeQueue.reserve(childrenLayout.numberOfNodes);
+    nodeQueue.push_back(childrenLayout.rootNode);
+    for (int queueHead = 0; queueHead < static_cast<int>(nodeQueue.size()); ++queueHead) {
+        int currentNode = nodeQueue[queueHead];
+        newIdOfNode[currentNode] = queueHead;
+        for (int position = childrenLayout.childOffsets[currentNode]; position < childrenLayout.childOffsets[currentNode + 1]; ++position) {
+            nodeQueue.push_back(childrenLayout.childNodes[position]);
+        }
+    }
+    return static_cast<int>(nodeQueue.size());
+}
+
+/**
+ * @brief Compute van Emde Boas ids
+ * @details A subtree covering H levels is cut after its top floor(H/2) levels. The top part is laid out
+ *          first, then each bottom subtree left to right, each recursively in the same way, so any
+ *          root-to-leaf walk touches O(log_B n) cache blocks for every block size B.
+ *          Tasks are kept on an explicit stack, so deep trees cannot overflow the call stack.
+ * @param childrenLayout Contiguous children layout of the tree
+ * @param newIdOfNode Receives the new id of every node reachable from the root
+ * @return Number of ids assigned
+ */
+int assignVanEmdeBoasIds(const ChildrenLayout& childrenLayout, std::vector<int>& newIdOfNode) {
+    // subtreeLevels[v] is the number of levels below and including v, filled bottom-up over a level order
+    std::vector<int> levelOrder;
+    levelOrder.reserve(childrenLayout.numberOfNodes);
+    levelOrder.push_back(childrenLayout.rootNode);
+    for (int queueHead = 0; queueHead < static_cast<int>(levelOrder.size()); ++queueHead) {
+        int currentNode = levelOrder[queueHead];
+        for (int position = childrenLayout.childOffsets[currentNode]; position < childrenLayout.childOffsets[currentNode + 1]; ++position) {
+            levelOrder.push_back(childrenLayout.childNodes[position]);
+        }
+    }
+    std::vector<int> subtreeLevels(childrenLayout.numberOfNodes, 1);
+    for (int orderIndex = static_cast<int>(levelOrder.size()) - 1; orderIndex >= 0; --orderIndex) {
+        int currentNode = levelOrder[orderIndex];
+        for (int position = childrenLayout.childOffsets[currentNode]; position < childrenLayout.childOffsets[currentNode + 1]; ++position) {
+            subtreeLevels[currentNode] = std::max(subtreeLevels[currentNode], subtreeLevels[childrenLayout.childNodes[position]] + 1);
+        }
+    }
+
+    // Each task lays out the first `levels` levels of the subtree under `subtreeRoot`
+    std::vector<std::pair<int, int>> taskStack;
+    std::vector<int> currentFrontier;
+    std::vector<int> nextFrontier;
+    int idCounter = 0;
+    taskStack.push_back({childrenLayout.rootNode, subtreeLevels[childrenLayout.rootNode]});
+
+    while (!taskStack.empty()) {
+        int subtreeRoot = taskStack.back().first;
+        int levels = taskStack.back().second;
+        taskStack.pop_back();
+        if (levels == 1) {
+            newIdOfNode[subtreeRoot] = idCounter++;
+            continue;
+        }
+
+        // Find the bottom subtree roots, topLevels below subtreeRoot, in left-to-right order
+        int topLevels = levels / 2;
+        int bottomLevels = levels - topLevels;
+        currentFrontier.assign(1, subtreeRoot);
+        for (int depth = 0; depth < topLevels && !currentFrontier.empty(); ++depth) {
+            nextFrontier.clear();
+            for (int frontierNode : currentFrontier) {
+                for (int position = childrenLayout.childOffsets[frontierNode]; position < childrenLayout.childOffsets[frontierNode + 1]; ++position) {
+                    nextFrontier.push_back(childrenLayout.childNodes[position]);
+                }
+            }
+            currentFrontier.swap(nextFrontier);
+        }
+
+        // Pushed in reverse so the top part pops first and bottom subtrees pop left to right
+        for (int frontierIndex = static_cast<int>(currentFrontier.size()) - 1; frontierIndex >= 0; --frontierIndex) {
+            int bottomRoot = currentFrontier[frontierIndex];
+            taskStack.push_back({bottomRoot, std::min(bottomLevels, subtreeLevels[bottomRoot])});
+        }
+        taskStack.push_back({subtreeRoot, topLevels});
+    }
+
+    return idCounter;
+}
+
+/**
+ * @brief Compute the relayout permutation of a tree
+ * @details Nodes unreachable from the root (malformed input) keep their relative order after all reachable nodes,
+ *          so the result is always a full permutation
+ * @param childrenLayout Contiguous children layout of the tree
+ * @param layoutOrder Order to assign new ids in
+ * @return newIdOfNode permutation
+ */
+std::vector<int> computeTreeLayoutPermutation(const ChildrenLayout& childrenLayout, TreeLayoutOrder layoutOrder) {
+    std::vector<int> newIdOfNode(childrenLayout.numberOfNodes, NIL_VALUE);
+    int assignedCount = 0;
+    if (childrenLayout.rootNode != NIL_VALUE) {
+        if (layoutOrder == TreeLayoutOrder::LevelOrder) {
+            assignedCount = assignLevelOrderIds(childrenLayout, newIdOfNode);
+        } else if (layoutOrder == TreeLayoutOrder::DepthFirst) {
+            PreorderIntervalTree intervalTree = convertChildrenLayoutToPreorderInterval(childrenLayout);
+            newIdOfNode.swap(intervalTree.preorderIndex);
+            assignedCount = static_cast<int>(intervalTree.preorderSequence.size());
+        } else {
+            assignedCount = assignVanEmdeBoasIds(childrenLayout, newIdOfNode);
+        }
+    }
+
+    for (int nodeIndex = 0; nodeIndex < childrenLayout.numberOfNodes; ++nodeIndex) {
+        if (newIdOfNode[nodeIndex] == NIL_VALUE) {
+            newIdOfNode[nodeIndex] = assignedCount++;
+        }
+    }
+    return newIdOfNode;
+}
+
+/**
+ * @brief Invert a relayout permutation
+ * @param newIdOfNode Permutation from old ids to new ids
+ * @return Permutation from new ids to old ids
+ */
+std::vector<int> invertTreeLayoutPermutation(const std::vector<int>& newIdOfNode) {
+    std::vector<int> originalIdOfNode(newIdOfNode.size());
+    for (int nodeIndex = 0; nodeIndex < static_cast<int>(newIdOfNode.size()); ++nodeIndex) {
+        originalIdOfNode[newIdOfNode[nodeIndex]] = nodeIndex;
+    }
+    return originalIdOfNode;
+}
+
+/**
+ * @brief Map a node id through a relayout permutation, keeping NIL_VALUE
+ * @param newIdOfNode Permutation from old ids to new ids
+ * @param nodeIndex Old id or NIL_VALUE
+ * @return New id or NIL_VALUE
+ */
+inline int mapNodeThroughLayout(const std::vector<int>& newIdOfNode, int nodeIndex) {
+    return nodeIndex == NIL_VALUE ? NIL_VALUE : newIdOfNode[nodeIndex];
+}
+
+/**
+ * @brief Renumber array of parents through a relayout permutation
+ * @param arrayParents Array of parents to renumber
+ * @param newIdOfNode Permutation from old ids to new ids
+ * @return ArrayOfParents structure with every node moved to its new id
+ */
+ArrayOfParents relayoutArrayOfParents(const ArrayOfParents& arrayParents, const std::vector<int>& newIdOfNode) {
+    ArrayOfParents relaidOutParents(arrayParents.numberOfNodes);
+    relaidOutParents.rootNode = mapNodeThroughLayout(newIdOfNode, arrayParents.rootNode);
+    for (int nodeIndex = 0; nodeIndex < arrayParents.numberOfNodes; ++nodeIndex) {
+        relaidOutParents.parentArray[newIdOfNode[nodeIndex]] = mapNodeThroughLayout(newIdOfNode, arrayParents.parentArray[nodeIndex]);
+    }
+    return relaidOutParents;
+}
+
+/**
+ * @brief Renumber first-child next-sibling through a relayout permutation
+ * @details Chains are mapped link by link, so sibling order is preserved exactly
+ * @param fcnsTree First-child next-sibling structure to renumber
+ * @param newIdOfNode Permutation from old ids to new ids
+ * @return FirstChildNextSibling structure with every node moved to its new id
+ */
+FirstChildNextSibling relayoutFirstChildNextSibling(const FirstChildNextSibling& fcnsTree, const std::vector<int>& newIdOfNode) {
+    FirstChildNextSibling relaidOutFCNS(fcnsTree.numberOfNodes);
+    relaidOutFCNS.rootNode = mapNodeThroughLayout(newIdOfNode, fcnsTree.rootNode);
+    for (int nodeIndex = 0; nodeIndex < fcnsTree.numberOfNodes; ++nodeIndex) {
+        relaidOutFCNS.firstChildArray[newIdOfNode[nodeIndex]] = mapNodeThroughLayout(newIdOfNode, fcnsTree.firstChildArray[nodeIndex]);
+        relaidOutFCNS.nextSiblingArray[newIdOfNode[nodeIndex]] = mapNodeThroughLayout(newIdOfNode, fcnsTree.nextSiblingArray[nodeIndex]);
+    }
+    return relaidOutFCNS;
+}
+
+/**
+ * @brief Renumber graph-based representation through a relayout permutation
+ * @param graphTree Graph-based representation to renumber
+ * @param newIdOfNode Permutation from old ids to new ids
+ * @return GraphBasedRepresentation structure with every node moved to its new id
+ */
+GraphBasedRepresentation relayoutGraphBased(const GraphBasedRepresentation& graphTree, const std::vector<int>& newIdOfNode) {
+    GraphBasedRepresentation relaidOutGraph(graphTree.numberOfNodes);
+    relaidOutGraph.rootNode = mapNodeThroughLayout(newIdOfNode, graphTree.rootNode);
+    for (int nodeIndex = 0; nodeIndex < graphTree.numberOfNodes; ++nodeIndex) {
+        std::vector<int>& relaidOutChildren = relaidOutGraph.adjacencyData[newIdOfNode[nodeIndex]];
+        relaidOutChildren.reserve(graphTree.adjacencyData[nodeIndex].size());
+        for (int childNode : graphTree.adjacencyData[nodeIndex]) {
+            relaidOutChildren.push_back(newIdOfNode[childNode]);
+        }
+    }
+    return relaidOutGraph;
+}
+
+/**
+ * @brief Renumber a tree into a cache-friendly layout and rewrite all three representations
+ * @param arrayParents Tree given as array of parents
+ * @param layoutOrder Order to assign new ids in
+ * @return RelaidOutTree holding the renumbered representations and the permutation
+ */
+RelaidOutTree relayoutTree(const ArrayOfParents& arrayParents, TreeLayoutOrder layoutOrder) {
+    ChildrenLayout childrenLayout = buildChildrenLayoutFromParents(arrayParents.parentArray, arrayParents.numberOfNodes);
+
+    RelaidOutTree relaidOutTree;
+    relaidOutTree.newIdOfNode = computeTreeLayoutPermutation(childrenLayout, layoutOrder);
+    relaidOutTree.originalIdOfNode = invertTreeLayoutPermutation(relaidOutTree.newIdOfNode);
+    relaidOutTree.arrayParents = relayoutArrayOfParents(arrayParents, relaidOutTree.newIdOfNode);
+    relaidOutTree.fcnsTree = relayoutFirstChildNextSibling(convertChildrenLayoutToFirstChildNextSibling(childrenLayout),
+                                                           relaidOutTree.newIdOfNode);
+    relaidOutTree.graphTree = relayoutGraphBased(convertChildrenLayoutToGraphBased(childrenLayout), relaidOutTree.newIdOfNode);
+    return relaidOutTree;
+}
+
+/**
+ * @brief Walk every first-child next-sibling chain in preorder
+ * @details Used to measure how the node layout affects pointer chasing; the result does not depend on the layout
+ * @param fcnsTree First-child next-sibling structure to walk
+ * @return Sum of the depths of all visited nodes
+ */
+long long sumNodeDepthsByChainWalk(const FirstChildNextSibling& fcnsTree) {
+    long long depthSum = 0;
+    if (fcnsTree.rootNode == NIL_VALUE) {
+        return depthSum;
+    }
+
+    // Each stack entry is a pending sibling together with its depth
+    std::vector<std::pair<int, int>> pendingSiblings;
+    pendingSiblings.push_back({fcnsTree.rootNode, 0});
+    while (!pendingSiblings.empty()) {
+        int currentNode = pendingSiblings.back().first;
+        int currentDepth = pendingSiblings.back().second;
+        pendingSiblings.pop_back();
+        while (currentNode != NIL_VALUE) {
+            depthSum += currentDepth;
+            if (fcnsTree.nextSiblingArray[currentNode] != NIL_VALUE) {
+                pendingSiblings.push_back({fcnsTree.nextSiblingArray[currentNode], currentDepth});
+            }
+            currentNode = fcnsTree.firstChildArray[currentNode];
+            currentDepth++;
+        }
+    }
+    return depthSum;
+}